@@ -1,5 +1,11 @@
 #pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
 #include "ssd1306.h"
+#include "calc.h"
+#include "calc_journal.h"
+#include "widget.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -8,7 +14,42 @@ extern "C" {
 // Runs the calculator: reads tokens from stdin and renders on the OLED.
 // Tokens now: hex number (0x... or plain hex), operator '+', 'c' to clear, 'q' to quit.
 // All arithmetic is 64-bit unsigned; result wraps on overflow.
-void app_run_calc(ssd1306_t *dev);
+// With a 'journal' (may be NULL) the session resumes from its current state,
+// every change is recorded and "undo"/"redo" step through the history.
+void app_run_calc(ssd1306_t *dev, calc_journal_t *journal);
+
+/**
+ * Non-interactive mode for scripts: reads whitespace-separated tokens from 'in'
+ * in large blocks, evaluates them with the pure calc_feed() core, prints no
+ * prompt, and prints the final result in hex on stdout.
+ * The display is refreshed every 'refresh_ms' milliseconds while input keeps
+ * coming (0 = only once at end of input). 'dev' may be NULL to skip rendering.
+ */
+void app_run_calc_batch(ssd1306_t *dev, FILE *in, uint32_t refresh_ms);
+
+// The calculator screen as retained widgets: input (row 0), OPERATION (row 1),
+// result headline (rows-5) and the 4x16 bit grid (bottom four rows). On panels
+// with fewer than 8 text rows the widgets that would land on a lower one's
+// rows are left out, as in the full-redraw layout.
+typedef struct {
+    widget_label_t   input;
+    widget_label_t   op;
+    widget_number_t  headline;
+    widget_bitgrid_t grid;
+    bool             show_input, show_op, show_headline;
+} app_calc_screen_t;
+
+/** Lay out the widgets for 'dev'; the first render paints every one of them. */
+void app_calc_screen_init(app_calc_screen_t *s, const ssd1306_t *dev);
+
+/** Force a full repaint on the next render (after something else drew over the panel). */
+void app_calc_screen_invalidate(app_calc_screen_t *s);
+
+/**
+ * Update the widgets of 's' from state 'c', repaint only those whose content
+ * changed and submit the changed regions for flushing.
+ */
+void app_calc_render(ssd1306_t *dev, app_calc_screen_t *s, const calc_t *c);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,26 @@
+// include/app_map.h
+#pragma once
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Map mode: compile 'expr' (calculator tokens, see calc_prog.h) and apply it
+ * to every value in the file at 'path' ("-" = stdin), writing the results to
+ * stdout. The input is mapped when it is a regular file.
+ *
+ * Text input is whitespace-separated numbers in any calculator base; the
+ * output is one number per line in the base the expression picks (hex by
+ * default). With 'raw' the input and output are packed uint64 values in host
+ * byte order.
+ *
+ * Throughput is reported on stderr as one JSON line. Returns a process exit
+ * code: 0 ok, 64 bad expression, 1 unreadable input or failed output.
+ */
+int app_run_map(const char *expr, const char *path, bool raw);
+
+#ifdef __cplusplus
+}
+#endif
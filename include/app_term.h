@@ -0,0 +1,64 @@
+// include/app_term.h
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ssd1306.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Log-tail console: the panel as a grid of 5x7 character cells (21x8 on a
+// 128x64 panel) that scrolls up as lines arrive.
+//
+// Text goes into a ring of rows. On a 64-row panel each ring slot is one RAM
+// page, so scrolling only moves the display start line and the newly exposed
+// page is the only one rewritten. On smaller panels rows are redrawn in place.
+// Either way only cells whose character changed are drawn and sent.
+
+#define APP_TERM_COLS_MAX  21
+
+typedef struct {
+    ssd1306_t *dev;
+    int       cols, rows;
+    bool      hw_scroll;                // scroll with the display start line
+
+    char      text[SSD1306_MAX_PAGES][APP_TERM_COLS_MAX];    // wanted, by ring slot
+    char      shown[SSD1306_MAX_PAGES][APP_TERM_COLS_MAX];   // on the panel, by page
+    uint32_t  line;                     // cursor line (ring slot = line % rows)
+    int       col;
+    bool      nl_pending;               // '\n' seen; scroll when more text arrives
+    int       top_shown;                // ring slot at the top of the panel
+
+    // Totals for diagnostics
+    uint64_t  flushes, cells_sent;
+} app_term_t;
+
+/** Clear the panel and reset the console for 'dev'. Returns 0 or <0. */
+int  app_term_init(app_term_t *t, ssd1306_t *dev);
+
+/**
+ * Append bytes to the console model: '\n' starts a new line, '\r' returns to
+ * column 0, '\t' advances to the next multiple of 4, long lines wrap.
+ * Nothing is drawn until app_term_flush().
+ */
+void app_term_write(app_term_t *t, const char *s, size_t n);
+
+/**
+ * Draw the cells that differ from the panel, send them, then move the start
+ * line if the console scrolled. However many lines were written since the last
+ * flush, at most one pass over the rows is sent. Returns 0 or <0.
+ */
+int  app_term_flush(app_term_t *t);
+
+/**
+ * Tail 'fd' until EOF. Input that is already waiting is all read before a
+ * flush, so a burst of lines costs one flush; a steady stream is still
+ * flushed at least every APP_TERM_MAX_LATENCY_MS.
+ */
+int  app_run_term(ssd1306_t *dev, int fd);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,110 @@
+// include/calc.h
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------- Display mode ----------
+typedef enum { DISP_HEX = 0, DISP_DEC, DISP_BIN } display_mode_t;
+
+// ---------- Calculator state ----------
+typedef enum {
+    ST_EXPECT_ANY = 0,   // number = load result; operator = wait for arg
+    ST_EXPECT_ARG
+} calc_state_t;
+
+typedef enum {
+    OP_NONE = 0,
+    OP_ADD, OP_SUB, OP_AND, OP_OR, OP_XOR, OP_SHL, OP_SHR,
+    OP_INVERT,          // unary, immediate
+    OP_SHOW_HEX, OP_SHOW_DEC, OP_SHOW_BIN   // display-change "ops"
+} op_t;
+
+#define CALC_INPUT_MAX  256   // longest token kept for display on row 0
+
+// Complete calculator state; also what the screen shows (input to app_calc_render).
+typedef struct {
+    uint64_t        result;
+    calc_state_t    state;
+    op_t            pending;            // binary op waiting for its argument
+    display_mode_t  disp;
+
+    // OPERATION display policy:
+    //  - shown when an operator is pending OR a non-immediate op just executed
+    //  - cleared only when an immediate value load occurs
+    bool            show_op;
+    const char     *op_name;            // static label (calc_op_label), "" when none
+
+    // Row 0 policy: show last token only if it was a number (not an op)
+    bool            last_was_op;
+    char            input_line[CALC_INPUT_MAX];   // last token as typed
+} calc_t;
+
+// Outcome of feeding one token.
+typedef enum {
+    CALC_OK = 0,        // state changed; the screen should be redrawn
+    CALC_EMPTY,         // blank token, nothing happened
+    CALC_QUIT,          // 'q'
+    CALC_BAD_NUMBER     // neither operator nor valid number; state unchanged
+} calc_status_t;
+
+/** Reset to the power-on state: result 0, hex display, nothing pending. */
+void calc_init(calc_t *c);
+
+/**
+ * Evaluate one token (NUL-terminated, no surrounding whitespace): a number,
+ * an operator word/symbol, 'c' to clear or 'q' to quit. Pure: no I/O.
+ */
+calc_status_t calc_feed(calc_t *c, const char *token);
+
+/** Same as calc_feed() for a token given by pointer and length (need not be NUL-terminated). */
+calc_status_t calc_feed_n(calc_t *c, const char *token, size_t n);
+
+/**
+ * Zero-copy tokenizer: skip whitespace from *pos, point *tok at the next token
+ * and return its length (0 when none is left before 'end').
+ * *pos is advanced past the token; the input is not modified.
+ */
+size_t calc_next_token(const char **pos, const char *end, const char **tok);
+
+// ---------- Formatting buffer sizes ----------
+#define CALC_HEX_LEN  (2 + 16 + 3 + 1)   // 0x + 16 digits + 3 '_' + NUL
+#define CALC_DEC_LEN  32
+#define CALC_BIN_LEN  (2 + 3 + 16 + 1)   // 0b + "..." + 16 digits + NUL
+
+/** Trim leading/trailing whitespace in place. */
+void calc_strtrim(char *s);
+
+/**
+ * Parse a 64-bit number: 0x.. hex, 0b.. binary, 0d.. or plain decimal.
+ * Underscores are accepted as digit separators.
+ * Returns 0 on success, <0 on malformed or out-of-range input.
+ */
+int  calc_parse_num64(const char *token, uint64_t *out);
+
+/** calc_parse_num64() on s[0..n); single pass, no copies. */
+int  calc_parse_num64n(const char *s, size_t n, uint64_t *out);
+
+/** Map an operator token (symbol or word, case-insensitive) to op_t; OP_NONE if not an operator. */
+op_t calc_parse_operator(const char *token);
+
+/** calc_parse_operator() on t[0..n); switch on length, no string compares. */
+op_t calc_parse_operator_n(const char *t, size_t n);
+
+/** Label shown on the OPERATION line for 'op'. */
+const char* calc_op_label(op_t op);
+
+/** True for operators that wait for a second argument. */
+bool calc_is_binary_op(op_t op);
+
+void calc_fmt_hex64(uint64_t v, char out[CALC_HEX_LEN]);       // 0xXXXX_XXXX_XXXX_XXXX
+void calc_fmt_dec64(uint64_t v, char out[CALC_DEC_LEN]);
+void calc_fmt_bin_tail16(uint64_t v, char out[CALC_BIN_LEN]);  // low 16 bits, "..." if more
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,57 @@
+// include/calc_journal.h
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include "calc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Session journal (src/calc_journal.c): every calculator state is appended as
+// a fixed 64-byte record to a memory-mapped file, so a restart resumes where
+// the last session stopped and undo/redo are one record seek each.
+//
+// File layout, host byte order:
+//   header   "OLEDJRN1" u32 record size, u32 capacity,
+//            u64 first, cur, last (sequence numbers; 0 = empty)     64 bytes
+//   records  capacity slots; sequence s lives in slot s % capacity
+// A record holds result, state, pending op, display mode, the op whose label
+// is shown, the two display flags and the first CALC_JOURNAL_INPUT_MAX-1
+// bytes of the input line (row 0 shows far fewer).
+//
+// 'cur' is the state on screen; records cur+1..last are the redo history,
+// dropped by the next new state. The file is a ring: once 'capacity' states
+// are kept the oldest is overwritten, so the journal never grows and needs
+// no separate compaction pass. A record repeating the current state is
+// not written. Records are written before the header points at them, so a
+// crash leaves the previous state current.
+
+#define CALC_JOURNAL_MAGIC      "OLEDJRN1"
+#define CALC_JOURNAL_CAPACITY   4096    // default ring size (256 KB file)
+#define CALC_JOURNAL_INPUT_MAX  42
+
+typedef struct calc_journal calc_journal_t;
+
+/**
+ * Open (or create) the journal at 'path' with room for 'capacity' states
+ * (0 = CALC_JOURNAL_CAPACITY). A journal of another capacity or a damaged
+ * one is started afresh; any other non-empty file is left alone (-4).
+ * Returns 0, or <0 on error.
+ */
+int  calc_journal_open(calc_journal_t **out, const char *path, uint32_t capacity);
+void calc_journal_close(calc_journal_t *j);
+
+/** Load the current state into 'c'. False (c untouched) when the journal is empty. */
+bool calc_journal_restore(const calc_journal_t *j, calc_t *c);
+
+/** Append 'c' as the new current state; the redo history is dropped. */
+void calc_journal_record(calc_journal_t *j, const calc_t *c);
+
+/** Step back / forward one state and load it into 'c'. False when there is none. */
+bool calc_journal_undo(calc_journal_t *j, calc_t *c);
+bool calc_journal_redo(calc_journal_t *j, calc_t *c);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,66 @@
+// include/calc_prog.h
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "calc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Calculator expressions compiled to a straight-line program over one value
+// (src/calc_prog.c), for applying the same op chain to large arrays.
+//
+// The source uses the calculator's token grammar, starting from the input
+// value instead of a loaded number: "and 0xFFFF << 3 xor 0b101 invert".
+// Binary ops take the next token as their argument; hex/dec/bin pick the
+// output base. Numbers in operator position, 'c' and 'q' are errors.
+//
+// Compilation folds the chain: subtract becomes add of the negation, invert
+// becomes xor with all ones, runs of add/and/or/xor merge into one op and
+// no-ops (add 0, shift 0, ...) are dropped.
+
+#define CALC_PROG_MAX  64       // ops after folding
+
+// Vector kernels (GCC/Clang vector extensions) unless built with -DCALC_PROG_VECTOR=0
+#ifndef CALC_PROG_VECTOR
+#if defined(__GNUC__)
+#define CALC_PROG_VECTOR  1
+#else
+#define CALC_PROG_VECTOR  0
+#endif
+#endif
+
+typedef struct {
+    op_t     op;                // OP_ADD, OP_AND, OP_OR, OP_XOR, OP_SHL or OP_SHR
+    uint64_t arg;               // shift counts are already masked to 0..63
+} calc_insn_t;
+
+typedef struct {
+    int            n;
+    display_mode_t disp;        // output base chosen by hex/dec/bin (default hex)
+    calc_insn_t    insn[CALC_PROG_MAX];
+} calc_prog_t;
+
+/**
+ * Compile src[0..len) into 'p'. Returns 0 on success, otherwise <0 with
+ * *err_at (if not NULL) set to the offending token's offset in 'src':
+ * -1 not an operator, -2 binary op without a number, -3 program too long.
+ */
+int calc_prog_compile(calc_prog_t *p, const char *src, size_t len, size_t *err_at);
+
+/** Run the program on one value (scalar reference). */
+uint64_t calc_prog_eval(const calc_prog_t *p, uint64_t v);
+
+/**
+ * out[i] = program(in[i]) for i < n. 'in' and 'out' may be the same array
+ * (but must not otherwise overlap); neither needs more than uint64_t alignment.
+ */
+void calc_prog_run(const calc_prog_t *p, const uint64_t *in, uint64_t *out, size_t n);
+
+/** Instruction set calc_prog_run() uses on this CPU: "avx2", "sse2", "vector" or "scalar". */
+const char* calc_prog_isa(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,12 +1,18 @@
 // include/gfx.h
 #pragma once
 #include <stdint.h>
-#include "ssd1306.h"
+#include "gfx_surface.h"
+#include "gfx_font.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Every primitive draws on a gfx_surface_t (gfx_surface.h): the panel's
+// framebuffer is &dev->surface, anything else is an off-screen buffer of at
+// most GFX_SURFACE_MAX_WIDTH (128) columns and GFX_SURFACE_MAX_HEIGHT rows;
+// gfx_surface_init() refuses larger ones.
+
 // ---- Text row/char metrics ----
 #define GFX_CHAR_ADVANCE     6   // 5px glyph + 1px spacing
 #define GFX_CHAR_HEIGHT      7   // 7px tall font
@@ -19,37 +25,112 @@ extern "C" {
 #define GFX_ALIGN_RIGHT     (-3)
 
 // ---- Convenience: query rows and text width ----
-int  gfx_text_rows(const ssd1306_t *dev);     // e.g., 8 rows on 128×64, 4 rows on 128×32
-int  gfx_text_width(const char *s);           // pixels = len * GFX_CHAR_ADVANCE
+int  gfx_text_rows(const gfx_surface_t *s);   // e.g., 8 rows on 128×64, 4 rows on 128×32
+int  gfx_text_width(const char *s);           // pixels in gfx_font_5x7 = len * GFX_CHAR_ADVANCE
 
 /**
  * Print 'text' on a logical text row.
- * - 'row' is 0..gfx_text_rows(dev)-1 (page index; each row is 8 px tall).
+ * - 'row' is 0..gfx_text_rows(s)-1 (page index; each row is 8 px tall).
  * - 'alignment_or_x':
  *     * GFX_ALIGN_LEFT / GFX_ALIGN_CENTRE / GFX_ALIGN_RIGHT
  *     * OR any non-negative integer x position (pixels from left).
- * Draws into the framebuffer only. Call ssd1306_update_full(dev) to push.
+ * Draws into the surface only; for the panel, ssd1306_submit() pushes it.
  * Returns 0 on success, <0 on error (e.g., row out of range).
  */
-int  gfx_print_line(ssd1306_t *dev, const char *text, int row, int alignment_or_x);
+int  gfx_print_line(gfx_surface_t *s, const char *text, int row, int alignment_or_x);
+
+/** The clamped left x that gfx_print_line() uses for 'text' with 'alignment_or_x'. */
+int  gfx_align_x(const gfx_surface_t *s, const char *text, int alignment_or_x);
 
 /** Clear a single text row (8px tall band). Does NOT push to display. */
-int  gfx_clear_line(ssd1306_t *dev, int row);
+int  gfx_clear_line(gfx_surface_t *s, int row);
 
-/** Set/clear a pixel in the framebuffer. */
-void gfx_set_pixel(ssd1306_t *dev, int x, int y, int on);
+/** Set/clear a pixel. */
+void gfx_set_pixel(gfx_surface_t *s, int x, int y, int on);
 
-/** Draw a 5x7 ASCII character at pixel (x,y). */
-void gfx_draw_char(ssd1306_t *dev, int x, int y, char c);
+/** Draw a 5x7 ASCII character (gfx_font_5x7) with its cell's top-left at pixel (x,y). */
+void gfx_draw_char(gfx_surface_t *s, int x, int y, char c);
 
 /** Draw a null-terminated string starting at (x,y). 6 px advance per char. */
-void gfx_draw_text(ssd1306_t *dev, int x, int y, const char *s);
+void gfx_draw_text(gfx_surface_t *s, int x, int y, const char *text);
+
+// ---- Font handles (gfx_font.h; atlases generated by tools/bdf2c) ----
+
+/** Glyph drawn for 'c' (the font's default_char outside its range). */
+const gfx_glyph_t *gfx_font_glyph(const gfx_font_t *font, char c);
+
+/** Kerning adjustment between 'left' and 'right' in px (0 if the pair has none). */
+int  gfx_font_kern(const gfx_font_t *font, char left, char right);
+
+/** Pixel width of 's' in 'font': advances plus kerning. */
+int  gfx_font_text_width(const gfx_font_t *font, const char *s);
+
+/**
+ * Draw 'text' in 'font' with the top-left of its cell at pixel (x,y), any y.
+ * The box font->height x gfx_font_text_width() is cleared first, so text
+ * replaces what was under it; rows outside the cell are left alone.
+ */
+void gfx_draw_text_font(gfx_surface_t *s, const gfx_font_t *font, int x, int y, const char *text);
 
 // Draw a filled axis-aligned rectangle; 'on' = 1 sets pixels, 0 clears pixels.
-void gfx_fill_rect(ssd1306_t *dev, int x, int y, int w, int h, int on);
+void gfx_fill_rect(gfx_surface_t *s, int x, int y, int w, int h, int on);
 
 // Draw just the rectangle outline.
-void gfx_draw_rect(ssd1306_t *dev, int x, int y, int w, int h, int on);
+void gfx_draw_rect(gfx_surface_t *s, int x, int y, int w, int h, int on);
+
+// ---- Surfaces ----
+
+/** Limit drawing on 's' to the rectangle x, y, w, h (intersected with the surface). */
+void gfx_set_clip(gfx_surface_t *s, int x, int y, int w, int h);
+
+/** Make the whole surface drawable again. */
+void gfx_reset_clip(gfx_surface_t *s);
+
+// How gfx_copy() combines a source pixel with the one under it.
+typedef enum {
+    GFX_ROP_COPY,       // dst = src
+    GFX_ROP_OR,         // set where src is set (transparent background)
+    GFX_ROP_AND,        // clear where src is clear (stencil)
+    GFX_ROP_XOR,        // invert where src is set (cursors; applying twice undoes it)
+} gfx_rop_t;
+
+/**
+ * Combine the w x h rectangle at (sx, sy) of 'src' into 'dst' at (dx, dy),
+ * clipped to the source and to dst's clip rectangle, any x/y offsets. Each
+ * destination byte is built from two shifted source bytes, one column loop
+ * per page. 'src' and 'dst' must not overlap (same surface: disjoint rectangles).
+ */
+void gfx_copy(gfx_surface_t *dst, int dx, int dy, const gfx_surface_t *src,
+              int sx, int sy, int w, int h, gfx_rop_t rop);
+
+// ---- Bitmaps ----
+
+// A 1bpp image (icon, sprite, gauge face) in the page-major layout of
+// surfaces and font atlases: (height + 7) / 8 pages of 'width' column bytes,
+// LSB = top row. Usually const data in flash.
+typedef struct {
+    uint16_t       width, height;   // pixels
+    const uint8_t *data;
+} gfx_bitmap_t;
+
+/**
+ * Draw 'bm' with its top-left at (x, y), any x/y, clipped. 'rop' is the mode:
+ * GFX_ROP_COPY opaque, GFX_ROP_OR transparent (only set pixels are drawn),
+ * GFX_ROP_XOR inverts under set pixels (drawing twice restores the
+ * background), GFX_ROP_AND clears under unset pixels. Same kernel as gfx_copy().
+ */
+void gfx_blit(gfx_surface_t *s, int x, int y, const gfx_bitmap_t *bm, gfx_rop_t rop);
+
+// ---- Lines and circles ('on' = 1 sets pixels, 0 clears them) ----
+
+/** Line from (x0,y0) to (x1,y1), both ends included (Bresenham). */
+void gfx_draw_line(gfx_surface_t *s, int x0, int y0, int x1, int y1, int on);
+
+/** Circle outline of radius r around (cx,cy) (midpoint algorithm). */
+void gfx_draw_circle(gfx_surface_t *s, int cx, int cy, int r, int on);
+
+/** Filled disc: the outline of gfx_draw_circle() and everything inside it. */
+void gfx_fill_circle(gfx_surface_t *s, int cx, int cy, int r, int on);
 
 #ifdef __cplusplus
 }
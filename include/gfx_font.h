@@ -0,0 +1,58 @@
+// include/gfx_font.h
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bitmap font atlases in SSD1306 page order, generated from BDF fonts by
+// tools/bdf2c (see `make fonts`).
+//
+// Glyph ink is stored column by column, 'pages' bytes per column (LSB = top
+// row of the cell, byte k = rows 8k..8k+7). When a font carries pre-shifted
+// copies, shifted[s] holds the same columns moved down by s rows, 'pages' + 1
+// bytes per column, so text at any y is a plain byte OR per column.
+
+#ifndef GFX_FONT_SHIFTED
+#define GFX_FONT_SHIFTED  1     // 0: generated fonts leave out the pre-shifted copies
+#endif
+
+#define GFX_FONT_MAX_HEIGHT  24 // cell rows; keeps a shifted column within 32 bits
+
+// gfx_font_t.flags
+#define GFX_FONT_CELLS  0x01    // glyphs stored as whole cells: bearing 0, width == advance
+
+typedef struct {
+    uint16_t offset;            // first column in cols[] / shifted[s][]
+    uint8_t  width;             // stored columns (ink only, or the whole cell: GFX_FONT_CELLS)
+    uint8_t  advance;           // pen advance in px
+    int8_t   bearing;           // x of the first ink column relative to the pen
+} gfx_glyph_t;
+
+typedef struct {
+    uint16_t pair;              // (left << 8) | right, table sorted ascending
+    int8_t   dx;                // added to the advance between the two glyphs
+} gfx_kern_t;
+
+typedef struct {
+    uint8_t            first, count;    // encoded range first..first+count-1
+    uint8_t            default_char;    // drawn for codes outside the range
+    uint8_t            height;          // cell rows, <= GFX_FONT_MAX_HEIGHT
+    uint8_t            pages;           // bytes per column: (height + 7) / 8
+    uint8_t            line_height;     // suggested row pitch in px
+    uint8_t            flags;           // GFX_FONT_*
+    const gfx_glyph_t *glyphs;          // 'count' entries
+    const uint8_t     *cols;            // unshifted columns, 'pages' bytes each
+    const uint8_t     *shifted[8];      // [1..7]: pre-shifted, 'pages'+1 bytes each; NULL if absent
+    const gfx_kern_t  *kern;            // NULL when nkern == 0
+    uint16_t           nkern;
+} gfx_font_t;
+
+/** The built-in 5x7 font (src/font_5x7.c, from fonts/5x7.bdf): 6 px advance, 8 px rows. */
+extern const gfx_font_t gfx_font_5x7;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,71 @@
+// include/gfx_surface.h
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Drawing target of every gfx_* and widget_* call: a page-major 1bpp buffer
+// (byte x of page p holds rows 8p..8p+7 of column x, LSB on top), the same
+// layout as the SSD1306 RAM. ssd1306_t exposes its framebuffer as
+// dev->surface; off-screen surfaces (pre-rendered chrome, sprites, layers)
+// wrap any width * pages bytes and are combined with gfx_copy().
+//
+// Drawing is clipped to the clip rectangle, which starts as the whole
+// surface. When dirty_x0/x1 are set, each primitive widens the touched
+// page's column span there, e.g. the driver's flush spans for dev->surface.
+
+#define GFX_SURFACE_MAX_WIDTH   128         // one page row fits a uint8_t column index
+#define GFX_SURFACE_MAX_HEIGHT  (8 * 255)   // pages fit a uint8_t
+
+typedef struct {
+    uint8_t *buf;               // width * pages bytes; NULL: nothing is drawn
+    uint16_t width, height;     // pixels
+    uint8_t  pages;             // (height + 7) / 8
+    int16_t  clip_x0, clip_y0;  // drawable rectangle, inclusive; empty when x0 > x1
+    int16_t  clip_x1, clip_y1;
+    uint8_t *dirty_x0;          // per-page spans (clean: x0 > x1); NULL: not tracked
+    uint8_t *dirty_x1;
+} gfx_surface_t;
+
+/**
+ * Wrap 'buf' (width * ((height + 7) / 8) bytes) with a full clip and no dirty
+ * tracking. Returns 0, or -1 when the size is outside 1..GFX_SURFACE_MAX_WIDTH
+ * x 1..GFX_SURFACE_MAX_HEIGHT; the surface is then empty and draws nothing.
+ */
+static inline int gfx_surface_init(gfx_surface_t *s, uint8_t *buf, int width, int height) {
+    const bool fits = width >= 1 && width <= GFX_SURFACE_MAX_WIDTH && height >= 1 && height <= GFX_SURFACE_MAX_HEIGHT;
+    if (!fits) { buf = NULL; width = 0; height = 0; }
+    s->buf = buf;
+    s->width = (uint16_t)width;
+    s->height = (uint16_t)height;
+    s->pages = (uint8_t)((height + 7) / 8);
+    s->clip_x0 = 0;
+    s->clip_y0 = 0;
+    s->clip_x1 = (int16_t)(width - 1);
+    s->clip_y1 = (int16_t)(height - 1);
+    s->dirty_x0 = NULL;
+    s->dirty_x1 = NULL;
+    return fits ? 0 : -1;
+}
+
+/** Rows of page p inside the clip rectangle, as a column-byte mask. */
+static inline uint8_t gfx_surface_clip_rows(const gfx_surface_t *s, int p) {
+    const int top = s->clip_y0 - 8 * p, bot = s->clip_y1 - 8 * p;
+    if (top > 7 || bot < 0 || s->clip_x0 > s->clip_x1) return 0;
+    return (uint8_t)((0xFFu >> (7 - (bot > 7 ? 7 : bot))) & (0xFFu << (top < 0 ? 0 : top)));
+}
+
+/** Widen page's dirty span to [x0, x1] (already clipped); no-op when untracked. */
+static inline void gfx_surface_mark(gfx_surface_t *s, int page, int x0, int x1) {
+    if (!s->dirty_x0) return;
+    if (x0 < s->dirty_x0[page]) s->dirty_x0[page] = (uint8_t)x0;
+    if (x1 > s->dirty_x1[page]) s->dirty_x1[page] = (uint8_t)x1;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,41 @@
+// include/oled_client.h
+#pragma once
+#include "ssd1306.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Display server client (src/oled_client.c, see oled_server.h).
+//
+// oled_client_dev() is an ssd1306_t whose framebuffer is the shared surface,
+// as large as the client's rectangle, so gfx_* and widget calls draw on its
+// ->surface as usual and an app lays itself out in the rectangle as it would
+// on a panel of that size. ssd1306_submit() on it (what the apps call) sends
+// the dirty spans as damage. It waits until the server has
+// composited them, then the surface is free for the next frame.
+// The device has no port: the other ssd1306_* bus calls and ssd1306_deinit()
+// must not be used on it. A fixed-geometry build (FIXED=WxH) can only own a
+// rectangle of that size.
+
+typedef struct oled_client oled_client_t;
+
+/**
+ * Connect to the server at 'path' (NULL: $OLED_SERVER_SOCKET or the default)
+ * and own the panel rectangle x, y, w, h (pixels). Returns 0, or <0 when no
+ * server answers or the surface cannot be mapped.
+ */
+int  oled_client_open(oled_client_t **out, const char *path, int x, int y, int w, int h);
+
+/** The drawing device; valid until oled_client_close(). */
+ssd1306_t* oled_client_dev(oled_client_t *c);
+
+/** Send the dirty spans to the server and wait until they are composited. Returns 0 or <0. */
+int  oled_client_commit(oled_client_t *c);
+
+/** Disconnect; the server uncovers the rectangle. */
+void oled_client_close(oled_client_t *c);
+
+#ifdef __cplusplus
+}
+#endif
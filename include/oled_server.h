@@ -0,0 +1,72 @@
+// include/oled_server.h
+#pragma once
+#include <signal.h>
+#include <stdint.h>
+#include "ssd1306.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Display server (src/oled_server.c, tools/server.c): one process owns the
+// panel and composites the drawings of local clients (oled_client.h).
+//
+// A client connects to a Unix seqpacket socket, names the panel rectangle it
+// owns and receives a memfd with a page-major 1bpp surface the size of that
+// rectangle (height rounded up to whole pages), shared with the server. It
+// draws there in its own coordinates, (0, 0) being the rectangle's top-left
+// corner, and sends damage messages (per-page column spans, the same shape as
+// ssd1306_t dirty tracking). The server moves the damaged runs to the
+// rectangle's position, rebuilds those panel bytes from every client, masked
+// to its rectangle, later clients on top, and flushes only what changed. No
+// pixel data goes through the socket.
+//
+// Pixels outside every client rectangle are off. When a client leaves, the
+// layers below it show again. When the server stops, the panel keeps the
+// last picture.
+
+#define OLED_SERVER_SOCKET       "/tmp/oled-server.sock"    // default path; $OLED_SERVER_SOCKET overrides
+#define OLED_SERVER_MAX_CLIENTS  8
+#define OLED_SERVER_HELLO_MS     1000   // a connection must say hello within this
+
+// ---------- Wire protocol (native byte order, one message per packet) ----------
+enum {
+    OLED_MSG_HELLO   = 'H',     // client -> server: rectangle to own
+    OLED_MSG_WELCOME = 'W',     // server -> client: geometry, memfd in SCM_RIGHTS
+    OLED_MSG_DAMAGE  = 'D',     // client -> server: dirty spans of the surface
+    OLED_MSG_ACK     = 'A',     // server -> client: damage composited, surface free to draw
+};
+
+typedef struct {
+    uint8_t  type;
+    uint8_t  reserved;
+    int16_t  x, y, w, h;        // panel rectangle; the server clips it to the panel
+} oled_msg_hello_t;
+
+typedef struct {
+    uint8_t  type;
+    uint8_t  reserved;
+    uint16_t width, height;     // surface geometry (the rectangle's); size is width * height / 8
+} oled_msg_welcome_t;
+
+typedef struct {
+    uint8_t  type;
+    uint8_t  x0[SSD1306_MAX_PAGES];     // page p is clean when x0[p] > x1[p]
+    uint8_t  x1[SSD1306_MAX_PAGES];
+} oled_msg_damage_t;
+
+/** Socket path to use: 'path', else $OLED_SERVER_SOCKET, else OLED_SERVER_SOCKET. */
+const char* oled_server_socket_path(const char *path);
+
+/**
+ * Serve clients on 'path' (see oled_server_socket_path) for panel 'dev' until
+ * *stop becomes nonzero (checked whenever a signal interrupts the wait).
+ * Frames go out with ssd1306_submit(), so start the flush thread first to
+ * keep clients from waiting on the bus. Returns 0, or <0 when the socket
+ * cannot be set up.
+ */
+int oled_server_run(ssd1306_t *dev, const char *path, volatile sig_atomic_t *stop);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,80 @@
+// include/perf.h
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Built-in performance counters (src/perf.c), compiled in with -DOLED_PERF=1
+// (`make PERF=1`). Without it every PERF_* macro expands to nothing and no
+// perf code is linked.
+//
+// Per probe: calls, errors, retries, bytes and time spent (total and max).
+// Plus one histogram: input received -> frame fully on the panel, in log2
+// microsecond buckets. The app marks input with PERF_INPUT(); the driver
+// closes the measurement when a flush completes (on the flush thread too).
+// Only the oldest input not yet on the panel is timed.
+//
+// Startup: exec -> main (from /proc, clock-tick resolution) and main ->
+// first frame on the panel (PERF_INSTALL to the first completed update).
+//
+// Counters are atomics, updated lock-free from any thread.
+
+#ifndef OLED_PERF
+#define OLED_PERF  0
+#endif
+
+typedef enum {
+    PERF_PORT_CMD = 0,      // command transactions (port_write_cmd/_cmds)
+    PERF_PORT_DATA,         // GDDRAM transactions (port_write_window/_data)
+    PERF_UPDATE_FULL,       // ssd1306_update_full
+    PERF_UPDATE_DIRTY,      // ssd1306_update_dirty
+    PERF_RENDER,            // app_calc_render: widgets to framebuffer (+ submit)
+    PERF_NPROBES
+} perf_probe_t;
+
+#define PERF_HIST_BUCKETS  32   // bucket i: [2^i, 2^(i+1)) us; bucket 0 also holds < 1 us
+
+#if OLED_PERF
+#include <stdio.h>
+
+uint64_t perf_now_ns(void);
+void     perf_record(perf_probe_t probe, uint64_t t0_ns, size_t bytes, int rc);
+void     perf_retry(perf_probe_t probe);
+void     perf_input(void);
+void     perf_input_idle(void);
+void     perf_frame_on_panel(void);
+
+/** Write every counter and the histogram as JSON lines (one object per line). */
+void     perf_dump(FILE *out);
+
+/**
+ * Dump to $OLED_PERF_OUT (default stderr) at exit and on every SIGUSR1.
+ * Call from main() before starting other threads: SIGUSR1 is then blocked in
+ * all of them and handled by a small sigwait() thread, so the dump runs in
+ * normal thread context.
+ */
+void     perf_install(void);
+
+#define PERF_T0(t)                    const uint64_t t = perf_now_ns()
+#define PERF_END(probe, t, bytes, rc) perf_record((probe), (t), (bytes), (rc))
+#define PERF_RETRY(probe)             perf_retry(probe)
+#define PERF_INPUT()                  perf_input()
+#define PERF_INPUT_IDLE()             perf_input_idle()     // input changed nothing on screen
+#define PERF_FRAME_ON_PANEL()         perf_frame_on_panel()
+#define PERF_INSTALL()                perf_install()
+#else
+#define PERF_T0(t)                    ((void)0)
+#define PERF_END(probe, t, bytes, rc) ((void)0)
+#define PERF_RETRY(probe)             ((void)0)
+#define PERF_INPUT()                  ((void)0)
+#define PERF_INPUT_IDLE()             ((void)0)
+#define PERF_FRAME_ON_PANEL()         ((void)0)
+#define PERF_INSTALL()                ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,22 +7,29 @@
 extern "C" {
 #endif
 
-// Display configuration provided to the port at init time.
+// Display configuration provided to the port when a panel is opened.
 typedef struct {
     uint8_t  i2c_addr;      // 0x3C or 0x3D for SSD1306 modules
     uint16_t width;         // 128
     uint16_t height;        // 64 or 32
+    uint8_t  i2c_bus;       // N in /dev/i2c-N
 } port_display_cfg_t;
 
+// One panel on one bus. Every port_* call that touches the bus takes the
+// handle, so a process can drive several panels (same or different buses).
+// A handle must not be used from two threads at once; handles on different
+// buses are independent, and handles sharing a bus are serialised by the bus.
+typedef struct port port_t;
+
 /**
- * Initialize the platform layer (GPIO/I2C, timers).
- * Must be called before any other port_* or SSD1306 functions.
+ * Open the panel described by 'cfg' (bringing up the platform layer on first
+ * use) and store its handle in *out.
  * Returns 0 on success, <0 on error.
  */
-int  port_init(const port_display_cfg_t *cfg);
+int  port_open(const port_display_cfg_t *cfg, port_t **out);
 
-/** Shut down the platform layer (optional). */
-void port_shutdown(void);
+/** Close a handle from port_open() (NULL is ignored). */
+void port_close(port_t *port);
 
 /** Millisecond delay helper provided by the platform. */
 void port_delay_ms(uint32_t ms);
@@ -31,17 +38,39 @@ void port_delay_ms(uint32_t ms);
  * Write a single SSD1306 command byte.
  * Returns 0 on success or <0 on error.
  */
-int  port_write_cmd(uint8_t cmd);
+int  port_write_cmd(port_t *port, uint8_t cmd);
+
+/**
+ * Write a list of SSD1306 command bytes (opcodes and their arguments) under a
+ * single 0x00 control prefix, i.e. one bus transaction instead of one per byte.
+ * Lists longer than port_max_xfer() are split by the port.
+ * Returns 0 on success or <0 on error.
+ */
+int  port_write_cmds(port_t *port, const uint8_t *cmds, size_t n);
+
+/**
+ * Zero-copy write of a framebuffer window: 'rows' runs of 'span' data bytes,
+ * consecutive runs 'stride' bytes apart (stride == span is one contiguous block).
+ * The byte just before each run must be writable and owned by the caller: the
+ * port may park the 0x40 control byte there instead of copying the payload, and
+ * restores it before returning. The driver keeps a spare byte in front of its
+ * framebuffer for this.
+ * Returns 0 on success or <0 on error.
+ */
+int  port_write_window(port_t *port, uint8_t *data, size_t span, size_t stride, size_t rows);
+
+/** Largest payload (excluding the control byte) the port puts in one transaction. */
+size_t port_max_xfer(const port_t *port);
 
 /**
  * Write N data bytes to the display (0x40 control prefix handled inside).
  * Safe to pass large buffers; the port may chunk them as needed.
  * Returns 0 on success or <0 on error.
  */
-int  port_write_data(const uint8_t *data, size_t len);
+int  port_write_data(port_t *port, const uint8_t *data, size_t len);
 
-/** Read-only access to the display configuration used by the port. */
-const port_display_cfg_t* port_get_cfg(void);
+/** Read-only access to the configuration the handle was opened with. */
+const port_display_cfg_t* port_get_cfg(const port_t *port);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,83 @@
+// include/port_sim.h
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "port.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Simulated SSD1306 behind the port API (src/port_sim.c, build with PORT=sim).
+// The command stream is decoded into an emulated panel and every bus
+// transaction is counted so transfer cost can be estimated without hardware.
+
+#define PORT_SIM_COLS   128     // SSD1306 GDDRAM geometry
+#define PORT_SIM_PAGES  8
+#define PORT_SIM_BUSES  16      // bus numbers are taken modulo this for timing
+
+// Emulated controller state, as set by the command stream.
+typedef struct {
+    uint8_t  gddram[PORT_SIM_PAGES][PORT_SIM_COLS];
+    uint8_t  addr_mode;         // 0 horizontal, 1 vertical, 2 page
+    uint8_t  col_start, col_end;    // 0x21 window
+    uint8_t  page_start, page_end;  // 0x22 window
+    uint8_t  col, page;         // RAM write pointer
+    uint8_t  start_line;        // 0x40..0x7F
+    uint8_t  contrast;
+    bool     inverted;
+    bool     display_on;
+} port_sim_panel_t;
+
+// Bus traffic counters.
+typedef struct {
+    uint64_t transactions;      // START .. STOP (or repeated START) frames
+    uint64_t cmd_bytes;         // command payload bytes
+    uint64_t data_bytes;        // GDDRAM payload bytes
+    uint64_t ctrl_bytes;        // 0x00/0x40 control bytes
+} port_sim_stats_t;
+
+// Every handle from port_open() is its own emulated panel with its own counters.
+
+/** Current emulated panel state. */
+const port_sim_panel_t* port_sim_panel(const port_t *port);
+
+/** Counters since port_open() or the last port_sim_reset_stats(). */
+const port_sim_stats_t* port_sim_stats(const port_t *port);
+void port_sim_reset_stats(port_t *port);
+
+/**
+ * Emulate bus timing at an I2C clock of 'hz' (0 = transfers are instant, the
+ * default; OLED_SIM_BUS_HZ sets it from the environment). Each transaction then
+ * holds its bus (cfg.i2c_bus) for its wire time, so panels on one bus share its
+ * bandwidth and panels on different buses transfer in parallel.
+ */
+void port_sim_set_bus_clock(uint32_t hz);
+
+/** Total bytes on the wire (address + control + payload) for the counted traffic. */
+uint64_t port_sim_wire_bytes(const port_sim_stats_t *st);
+
+/**
+ * Estimated wall-clock bus time in microseconds for the counted traffic at an
+ * I2C clock of 'hz' (e.g. 100000, 400000, 1000000). Each byte costs 9 clocks
+ * (8 bits + ACK) and each transaction adds START/STOP and the address byte.
+ */
+double port_sim_bus_time_us(const port_sim_stats_t *st, uint32_t hz);
+
+/**
+ * Compare a page-major framebuffer (width x pages bytes) against panel RAM.
+ * Returns -1 when identical, otherwise the index of the first differing byte.
+ */
+long port_sim_compare(const port_t *port, const uint8_t *fb, uint16_t width, uint8_t pages);
+
+/** Print the panel as seen (RAM rotated by the display start line) as ASCII art ('#' = lit) to 'out'. */
+void port_sim_dump_ascii(const port_t *port, FILE *out, uint16_t width, uint8_t pages);
+
+/** Print the counters and the panel to 'out' (what port_close() prints with OLED_SIM_REPORT=1). */
+void port_sim_report(const port_t *port, FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,35 +3,143 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
+#include "gfx_surface.h"
+#include "port.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-typedef struct {
+#define SSD1306_MAX_PAGES   8   // 64 px tall is the largest SSD1306 panel
+
+// ---- Fixed-geometry build ----
+// Build with -DSSD1306_FIXED_WIDTH=128 -DSSD1306_FIXED_HEIGHT=64 (or 32), e.g.
+// `make FIXED=128x64`, to make the panel size a compile-time constant: the
+// driver and gfx kernels read it through SSD1306_WIDTH/HEIGHT/PAGES and fold
+// it, and framebuffers come from a static pool of SSD1306_FIXED_PANELS slots,
+// so the core needs neither malloc nor stdio. Panels of another size fail init.
+#if defined(SSD1306_FIXED_WIDTH) != defined(SSD1306_FIXED_HEIGHT)
+#error "define both SSD1306_FIXED_WIDTH and SSD1306_FIXED_HEIGHT"
+#endif
+
+#ifdef SSD1306_FIXED_WIDTH
+#if SSD1306_FIXED_WIDTH < 1 || SSD1306_FIXED_WIDTH > 128 || SSD1306_FIXED_HEIGHT % 8 || \
+    SSD1306_FIXED_HEIGHT < 8 || SSD1306_FIXED_HEIGHT > 8 * SSD1306_MAX_PAGES
+#error "SSD1306_FIXED_WIDTH must be 1..128, SSD1306_FIXED_HEIGHT a multiple of 8 up to 64"
+#endif
+#ifndef SSD1306_FIXED_PANELS
+#define SSD1306_FIXED_PANELS  1     // framebuffers in the static pool
+#endif
+#define SSD1306_WIDTH(dev)   ((void)(dev), (int)SSD1306_FIXED_WIDTH)
+#define SSD1306_HEIGHT(dev)  ((void)(dev), (int)SSD1306_FIXED_HEIGHT)
+#define SSD1306_PAGES(dev)   ((void)(dev), (int)(SSD1306_FIXED_HEIGHT / 8))
+#else
+#define SSD1306_WIDTH(dev)   ((int)(dev)->width)
+#define SSD1306_HEIGHT(dev)  ((int)(dev)->height)
+#define SSD1306_PAGES(dev)   ((int)(dev)->pages)
+#endif
+
+struct ssd1306_async;           // background flusher, see ssd1306_async.h
+
+typedef struct ssd1306 ssd1306_t;
+
+// Called after every push that sent data, once the frame is on the panel
+// (dev->shadow holds it). Runs on the flushing thread. See ssd1306_capture.h.
+typedef void (*ssd1306_flush_hook_t)(void *ctx, const ssd1306_t *dev);
+
+// Takes the place of the bus flush in ssd1306_submit() for devices that draw
+// into a display server surface (oled_client.h). Returns 0 or <0.
+typedef int (*ssd1306_submit_hook_t)(void *ctx, ssd1306_t *dev);
+
+struct ssd1306 {
+    port_t  *port;      // the panel's bus handle (not owned)
     uint16_t width;     // pixels
     uint16_t height;    // pixels
     uint8_t  pages;     // height / 8
-    uint8_t *buffer;    // width * pages bytes, owned by the driver
-} ssd1306_t;
+    uint8_t *buffer;    // width * pages bytes, owned by the driver (heap or static pool)
+
+    // Dirty tracking: columns [dirty_x0[p], dirty_x1[p]] of page p were modified
+    // since the last flush. A page is clean when dirty_x0 > dirty_x1.
+    uint8_t  dirty_x0[SSD1306_MAX_PAGES];
+    uint8_t  dirty_x1[SSD1306_MAX_PAGES];
+
+    uint8_t *shadow;    // copy of what the panel holds, used to trim dirty spans
+    bool     synced;    // false until the first full push after init
+
+    size_t   last_flush_bytes;  // bytes (commands + data) sent by the last update
 
-/** Initialize driver: allocates framebuffer, configures panel, turns display ON. */
-int  ssd1306_init(ssd1306_t *dev);
+    struct ssd1306_async *async;    // NULL unless ssd1306_async_start() was called
 
-/** Deinitialize driver: frees framebuffer; does not power-cycle the bus. */
+    ssd1306_flush_hook_t on_flush;  // optional; set before ssd1306_async_start()
+    void                *on_flush_ctx;
+
+    ssd1306_submit_hook_t remote_submit;    // NULL for a panel behind a port
+    void                 *remote_ctx;
+
+    // The framebuffer as a gfx surface (gfx.h): draws mark the dirty spans
+    // above. Set up by init; points into this struct, so do not copy it.
+    gfx_surface_t surface;
+};
+
+/**
+ * Initialize driver for the panel behind 'port' (geometry from its config):
+ * allocates framebuffer, configures panel, turns display ON.
+ */
+int  ssd1306_init(ssd1306_t *dev, port_t *port);
+
+/**
+ * Warm attach: take over a panel that an earlier run configured and left on,
+ * without the init sequence (no display-off flash). Only the addressing state
+ * the driver relies on is restored: horizontal mode, start line 0, display on.
+ * 'frame' (width * pages bytes, may be NULL) is what the panel shows, e.g.
+ * from ssd1306_state_load(): it becomes the framebuffer and the shadow, so the
+ * first update sends only what differs. Without it the first update is a full push.
+ */
+int  ssd1306_init_warm(ssd1306_t *dev, port_t *port, const uint8_t *frame);
+
+/** Deinitialize driver: frees framebuffer; does not power-cycle the bus. Stop any flush thread first. */
 void ssd1306_deinit(ssd1306_t *dev);
 
-/** Clear framebuffer to 0 (off). */
+/** Clear framebuffer to 0 (off). Only pages/columns that were lit become dirty. */
 void ssd1306_clear(ssd1306_t *dev);
 
 /** Push entire framebuffer to the panel (full refresh). */
-int  ssd1306_update_full(const ssd1306_t *dev);
+int  ssd1306_update_full(ssd1306_t *dev);
+
+/**
+ * Push only the regions marked dirty since the last update.
+ * Dirty spans are trimmed against the panel shadow, adjacent pages are merged
+ * into one 0x21/0x22 window when that is cheaper than opening a new one.
+ * The number of bytes sent is left in dev->last_flush_bytes.
+ * Returns 0 on success (including "nothing to send"), <0 on error.
+ */
+int  ssd1306_update_dirty(ssd1306_t *dev);
+
+/** Mark a pixel rectangle as modified (clipped to the panel). */
+void ssd1306_mark_dirty(ssd1306_t *dev, int x, int y, int w, int h);
+
+/** Mark the whole framebuffer as modified. */
+void ssd1306_mark_all_dirty(ssd1306_t *dev);
+
+/** Bind dev->surface to the framebuffer and dirty spans, with a full clip. */
+static inline void ssd1306_bind_surface(ssd1306_t *dev) {
+    gfx_surface_init(&dev->surface, dev->buffer, SSD1306_WIDTH(dev), SSD1306_HEIGHT(dev));
+    dev->surface.dirty_x0 = dev->dirty_x0;
+    dev->surface.dirty_x1 = dev->dirty_x1;
+}
+
+/** Fast path for already-clipped callers: widen page's dirty span to [x0, x1]. */
+static inline void ssd1306_mark_dirty_span(ssd1306_t *dev, int page, int x0, int x1) {
+    if (x0 < dev->dirty_x0[page]) dev->dirty_x0[page] = (uint8_t)x0;
+    if (x1 > dev->dirty_x1[page]) dev->dirty_x1[page] = (uint8_t)x1;
+}
 
 /** Optional helpers */
-int  ssd1306_set_contrast(uint8_t value);   // 0x00..0xFF
-int  ssd1306_set_invert(bool enable);       // invert pixels
-int  ssd1306_display_on(bool on);           // true=ON, false=OFF
+int  ssd1306_set_contrast(ssd1306_t *dev, uint8_t value);   // 0x00..0xFF
+int  ssd1306_set_invert(ssd1306_t *dev, bool enable);       // invert pixels
+int  ssd1306_display_on(ssd1306_t *dev, bool on);           // true=ON, false=OFF
+int  ssd1306_set_start_line(ssd1306_t *dev, uint8_t line);  // RAM row shown at the top (0..63); hardware scroll
 
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,72 @@
+// include/ssd1306_async.h
+#pragma once
+#include <stdint.h>
+#include "ssd1306.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Background flushing (src/ssd1306_async.c).
+//
+// Callers keep drawing into dev->buffer (the back buffer). ssd1306_submit()
+// copies it into a mailbox slot and returns at once; a flush thread swaps
+// the newest mailbox frame into its front buffer and sends its dirty regions.
+// Frames submitted while a transfer is running replace each other: only the
+// latest one reaches the panel, with the union of their dirty regions.
+//
+// There is one flush thread per I2C bus (cfg.i2c_bus), shared by every
+// started panel on that bus. It serves them round-robin, one frame per panel
+// per turn. Panels on different buses flush concurrently, so the aggregate
+// frame rate grows with the number of buses.
+//
+// While a panel is started, its bus thread owns that panel's port: don't call
+// ssd1306_update_full/_dirty, contrast/invert or port_* on it from other threads.
+
+#ifndef SSD1306_ASYNC_MAX_PER_BUS
+#define SSD1306_ASYNC_MAX_PER_BUS  8    // panels one bus thread can serve
+#endif
+
+typedef struct {
+    uint64_t submitted;     // frames handed to ssd1306_submit()
+    uint64_t flushed;       // frames that reached the panel
+    uint64_t dropped;       // frames replaced by a newer one before being sent
+    int      last_error;    // <0 if the most recent flush failed, else 0
+} ssd1306_async_stats_t;
+
+/**
+ * Hand an initialized device to the flush thread of its bus (started on first
+ * use). Returns 0, or <0 on error (-5: SSD1306_ASYNC_MAX_PER_BUS reached).
+ */
+int  ssd1306_async_start(ssd1306_t *dev);
+
+/**
+ * Send any pending frame and return the device to synchronous flushing; the
+ * bus thread exits with the last panel on its bus.
+ */
+void ssd1306_async_stop(ssd1306_t *dev);
+
+/**
+ * Queue the current framebuffer (and its dirty regions) for the flush thread.
+ * Never waits for the bus. Returns the frame's sequence number (>0).
+ * Without a running thread this is a synchronous ssd1306_update_dirty() and
+ * returns 0 on success or <0 on error; a display server client device sends
+ * its damage instead (oled_client.h), with the same return values.
+ */
+int64_t ssd1306_submit(ssd1306_t *dev);
+
+/**
+ * Block until frame 'seq' or a newer one is fully on the panel (seq <= 0
+ * returns at once). Returns 0 if the flush that carried frame 'seq' (or the
+ * newer frame that replaced it) succeeded, <0 if that flush failed. Only the
+ * panel's most recent failed flush is remembered: if another one fails before
+ * the caller wakes up, an earlier failure reads as 0.
+ */
+int  ssd1306_wait_frame(ssd1306_t *dev, int64_t seq);
+
+/** Snapshot of the flush counters (zeroed when no thread is running). */
+void ssd1306_async_get_stats(ssd1306_t *dev, ssd1306_async_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,66 @@
+// include/ssd1306_capture.h
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ssd1306.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Frame capture (src/ssd1306_capture.c): a flush hook that appends every frame
+// that reaches the panel to a file, and a reader that plays such files back
+// (tools/replay.c).
+//
+// File format, little-endian:
+//   header   "OLEDCAP1" u16 width, u16 height                          12 bytes
+//   'S'      u64 wall-clock time in us (CLOCK_REALTIME)                session start
+//   'F'      varint dt_us, u8 page mask, then per set page p, ascending:
+//              u8 x0, u8 n-1, n bytes = columns x0..x0+n-1 of page p
+// dt_us is the time since the previous frame of the session (0 for the first).
+// Each page carries one run spanning its changed bytes relative to the
+// previous frame. The first frame after 'S' has every page in full, so a
+// reader can start at any session. A file is a sequence of sessions: a
+// capture appending to an existing file begins a new one.
+//
+// Only framebuffer contents are recorded; the hardware scroll offset
+// (ssd1306_set_start_line) and contrast/invert commands are not.
+
+#define SSD1306_CAPTURE_MAGIC    "OLEDCAP1"
+#define SSD1306_CAPTURE_HDR_LEN  12
+
+/**
+ * Start recording 'dev' to 'path' (created, or appended to if it holds a
+ * capture of the same geometry). With max_bytes > 0 the file is rotated to
+ * "<path>.1" once it grows past that size, so at most ~2 x max_bytes are kept.
+ * Call before ssd1306_async_start(). Returns 0, or <0 on error.
+ */
+int  ssd1306_capture_start(ssd1306_t *dev, const char *path, size_t max_bytes);
+
+/** Stop recording and close the file. Call after ssd1306_async_stop(). */
+void ssd1306_capture_stop(ssd1306_t *dev);
+
+// ---- Reading ----
+typedef struct {
+    const uint8_t *pos, *end;           // unread part of the file image
+    uint16_t       width, height;
+    uint64_t       t_us;                // recorded time of the last frame; sessions are
+                                        //   joined end to end (no gap between them)
+    uint64_t       wall_us;             // wall-clock start of the current session
+    uint32_t       frames, sessions;    // read so far
+} ssd1306_capture_reader_t;
+
+/** Check the header of the file image [data, data+len). Returns 0, or <0 if it is not a capture. */
+int  ssd1306_capture_reader_init(ssd1306_capture_reader_t *r, const void *data, size_t len);
+
+/**
+ * Apply the next frame to dev->buffer (same geometry as the file) and mark
+ * the changed bytes dirty. Returns 1 for a frame, 0 at the end of the file,
+ * <0 if the file is truncated or corrupt.
+ */
+int  ssd1306_capture_read(ssd1306_capture_reader_t *r, ssd1306_t *dev);
+
+#ifdef __cplusplus
+}
+#endif
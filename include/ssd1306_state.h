@@ -0,0 +1,37 @@
+// include/ssd1306_state.h
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "ssd1306.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Panel state file (src/ssd1306_state.c): the frame the panel shows, saved on
+// exit so the next run can warm-attach (ssd1306_init_warm) without a
+// reconfigure or a full push.
+//
+// File format, little-endian:
+//   "OLEDST01" u16 width, u16 height, then width * height / 8 bytes of
+//   page-major panel RAM.
+
+#define SSD1306_STATE_MAGIC  "OLEDST01"
+
+/**
+ * Write what the panel of 'dev' holds (its shadow) to 'path', through a
+ * temporary file and rename, so a crash never leaves a torn state file.
+ * Stop any flush thread first. Returns 0, or <0 on error.
+ */
+int ssd1306_state_save(const ssd1306_t *dev, const char *path);
+
+/**
+ * Read a state file for a width x height panel into 'frame' (width *
+ * height / 8 bytes). Returns 0, -1 when missing or unreadable, -2 when it
+ * belongs to a panel of another size.
+ */
+int ssd1306_state_load(const char *path, uint16_t width, uint16_t height, uint8_t *frame);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,102 @@
+// include/widget.h
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include "ssd1306.h"
+#include "calc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Retained-mode widgets. Each widget caches what it last drew and is only
+// re-rasterised when its content changes; the pixels it touches are marked
+// dirty on the surface, so the next flush covers just those regions. Widgets
+// draw on any gfx_surface_t: the panel's dev->surface or an off-screen one.
+//
+// Setters compare against the cached content and mark the widget dirty only on
+// a real change; *_draw() repaints a dirty widget and returns true if it did.
+// After anything else overwrites the surface (e.g. ssd1306_clear), call
+// *_invalidate() so the widget repaints itself in full.
+
+#define WIDGET_TEXT_MAX  64
+
+// One line of text on a text row (see gfx_print_line for 'align').
+typedef struct {
+    int   row;
+    int   align;                        // GFX_ALIGN_* or explicit x
+    char  text[WIDGET_TEXT_MAX];
+    int   drawn_x, drawn_w;             // pixel span painted last time
+    bool  dirty;
+} widget_label_t;
+
+void widget_label_init(widget_label_t *w, int row, int align);
+void widget_label_set(widget_label_t *w, const char *text);
+void widget_label_invalidate(widget_label_t *w);
+bool widget_label_draw(widget_label_t *w, gfx_surface_t *s);
+
+// A 64-bit value shown as a label in hex, decimal or binary (calc formatters).
+typedef struct {
+    widget_label_t  label;
+    uint64_t        value;
+    display_mode_t  mode;
+    bool            valid;              // false until the first set
+} widget_number_t;
+
+void widget_number_init(widget_number_t *w, int row, int align);
+void widget_number_set(widget_number_t *w, uint64_t value, display_mode_t mode);
+void widget_number_invalidate(widget_number_t *w);
+bool widget_number_draw(widget_number_t *w, gfx_surface_t *s);
+
+// Bit grid: one box per bit of a 'bits'-wide word, filled = 1, hollow = 0,
+// MSB first, laid out 'cols' cells per text row with an extra 'gap' px after
+// every 'group' cells. Each box sits inside one 8px page, so a cell is just
+// box_w column bytes written from precomputed patterns.
+typedef struct {
+    uint8_t bits;                       // word width: 8, 16, 32 or 64
+    uint8_t cols;                       // cells per row; bits % cols == 0
+    uint8_t cell_w;                     // px per cell horizontally
+    uint8_t box_w, box_h;               // box size; box_w <= cell_w, <= 8
+    uint8_t group, gap;                 // 'gap' extra px after every 'group' cells
+} widget_bitgrid_geom_t;
+
+// The calculator's 64-bit grid: 4 rows x 16 cells, 5x5 boxes, nibble gaps.
+#define WIDGET_BITGRID_GEOM_64  { 64, 16, 7, 5, 5, 4, 1 }
+
+#define WIDGET_BITGRID_BOX_MAX  8
+
+typedef struct {
+    int       row0;                     // first text row of the grid
+    widget_bitgrid_geom_t geom;
+    uint8_t   filled[WIDGET_BITGRID_BOX_MAX];   // column bytes of a '1' box
+    uint8_t   hollow[WIDGET_BITGRID_BOX_MAX];   // column bytes of a '0' box
+    uint8_t   box_mask;                 // bits of a column byte owned by the box
+
+    uint64_t  value;                    // what the grid should show
+    uint64_t  drawn;                    // what the panel shows (when 'painted')
+    bool      valid;                    // false until the first set
+    bool      painted;                  // false after init/invalidate: full repaint
+    bool      dirty;
+
+    // Column-byte ranges rewritten by the last draw, per page (clean: x0 > x1)
+    uint8_t   touched_x0[SSD1306_MAX_PAGES], touched_x1[SSD1306_MAX_PAGES];
+} widget_bitgrid_t;
+
+/** The 64-bit calculator grid (WIDGET_BITGRID_GEOM_64) starting at text row 'row0'. */
+void widget_bitgrid_init(widget_bitgrid_t *w, int row0);
+
+/** Grid with geometry 'g'. Returns 0, or <0 if 'g' is inconsistent. */
+int  widget_bitgrid_init_geom(widget_bitgrid_t *w, int row0, const widget_bitgrid_geom_t *g);
+
+void widget_bitgrid_set(widget_bitgrid_t *w, uint64_t value);
+void widget_bitgrid_invalidate(widget_bitgrid_t *w);
+
+/**
+ * Repaint the grid: only the cells in (drawn ^ value) are rewritten, unless the
+ * widget was invalidated. Fills touched_x0/x1 and returns true if it drew.
+ */
+bool widget_bitgrid_draw(widget_bitgrid_t *w, gfx_surface_t *s);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,169 @@
+// src/app_map.c
+// Map mode: one compiled calculator expression over a file of values (see app_map.h).
+#define _POSIX_C_SOURCE 200809L   // clock_gettime, posix_madvise
+#include "app_map.h"
+#include "calc.h"
+#include "calc_prog.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef APP_MAP_BLOCK
+#define APP_MAP_BLOCK  4096         // values per kernel call and output write
+#endif
+#define MAP_TEXT_MAX   (2 + 64 + 1) // longest output line: 0b + 64 digits + '\n'
+
+static uint64_t s_vals[APP_MAP_BLOCK];
+static char     s_text[APP_MAP_BLOCK * MAP_TEXT_MAX];
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// ---------- Input ----------
+// The whole input, mapped (regular files) or read into the heap (pipes).
+typedef struct {
+    const uint8_t *data;
+    size_t         len;
+    void          *map;
+    uint8_t       *heap;
+} map_input_t;
+
+static int input_open(map_input_t *in, const char *path) {
+    memset(in, 0, sizeof(*in));
+    const int fd = strcmp(path, "-") == 0 ? STDIN_FILENO : open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) return -1;
+
+    if (S_ISREG(st.st_mode) && st.st_size > 0) {
+        in->map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (in->map != MAP_FAILED) {
+            posix_madvise(in->map, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+            in->data = (const uint8_t *)in->map;
+            in->len  = (size_t)st.st_size;
+            if (fd != STDIN_FILENO) close(fd);
+            return 0;
+        }
+        in->map = NULL;
+    }
+
+    // Not mappable (pipe, tty, empty file): read it all
+    size_t cap = 0;
+    ssize_t got = 1;
+    while (got > 0) {
+        if (in->len == cap) {
+            uint8_t *grown = (uint8_t *)realloc(in->heap, cap = cap ? cap * 2 : 1u << 20);
+            if (!grown) { got = -1; break; }
+            in->heap = grown;
+        }
+        got = read(fd, in->heap + in->len, cap - in->len);
+        if (got > 0) in->len += (size_t)got;
+    }
+    if (fd != STDIN_FILENO) close(fd);
+    in->data = in->heap;
+    return got == 0 ? 0 : -1;
+}
+
+static void input_close(map_input_t *in) {
+    if (in->map) munmap(in->map, in->len);
+    free(in->heap);
+}
+
+// ---------- Output ----------
+static char *fmt_value(char *o, uint64_t v, display_mode_t disp) {
+    static const char HEX[] = "0123456789ABCDEF";
+    switch (disp) {
+        case DISP_DEC: {
+            char d[20];
+            int n = 0;
+            do { d[n++] = (char)('0' + v % 10u); v /= 10u; } while (v);
+            while (n) *o++ = d[--n];
+            break;
+        }
+        case DISP_BIN:
+            *o++ = '0'; *o++ = 'b';
+            for (int i = 63; i >= 0; --i) *o++ = (char)('0' + ((v >> i) & 1u));
+            break;
+        default:
+            *o++ = '0'; *o++ = 'x';
+            for (int i = 60; i >= 0; i -= 4) *o++ = HEX[(v >> i) & 0xFu];
+            break;
+    }
+    *o++ = '\n';
+    return o;
+}
+
+// Run the program over s_vals[0..n) and write the results as text.
+static int flush_text(const calc_prog_t *prog, size_t n, uint64_t *kernel_ns) {
+    const uint64_t t0 = now_ns();
+    calc_prog_run(prog, s_vals, s_vals, n);
+    *kernel_ns += now_ns() - t0;
+    char *o = s_text;
+    for (size_t i = 0; i < n; ++i) o = fmt_value(o, s_vals[i], prog->disp);
+    const size_t len = (size_t)(o - s_text);
+    return fwrite(s_text, 1, len, stdout) == len ? 0 : -1;
+}
+
+// ---------- Public entry ----------
+int app_run_map(const char *expr, const char *path, bool raw) {
+    if (!expr || !path) return 64;
+
+    calc_prog_t prog;
+    size_t err_at = 0;
+    const int crc = calc_prog_compile(&prog, expr, strlen(expr), &err_at);
+    if (crc < 0) {
+        fprintf(stderr, "map: %s at \"%s\"\n",
+                crc == -1 ? "expected an operator" : crc == -2 ? "operator needs a number" : "expression too long",
+                expr + err_at);
+        return 64;
+    }
+
+    map_input_t in;
+    if (input_open(&in, path) < 0) { perror(path); input_close(&in); return 1; }
+
+    uint64_t values = 0, bad = 0, kernel_ns = 0;
+    int rc = 0;
+    const uint64_t t0 = now_ns();
+    if (raw) {
+        // Mapped and heap input are both suitably aligned to read as uint64 directly
+        const uint64_t *v = (const uint64_t *)(const void *)in.data;
+        const size_t n = in.len / sizeof(uint64_t);
+        for (size_t at = 0; at < n && rc == 0; at += APP_MAP_BLOCK) {
+            const size_t m = (n - at < APP_MAP_BLOCK) ? n - at : APP_MAP_BLOCK;
+            const uint64_t k0 = now_ns();
+            calc_prog_run(&prog, &v[at], s_vals, m);
+            kernel_ns += now_ns() - k0;
+            if (fwrite(s_vals, sizeof(uint64_t), m, stdout) != m) rc = -1;
+        }
+        values = n;
+        if (in.len % sizeof(uint64_t)) fprintf(stderr, "map: ignored %zu trailing bytes\n", in.len % sizeof(uint64_t));
+    } else {
+        const char *pos = (const char *)in.data, *end = pos + in.len, *tok;
+        size_t n, k = 0;
+        while (rc == 0 && (n = calc_next_token(&pos, end, &tok)) != 0) {
+            if (calc_parse_num64n(tok, n, &s_vals[k]) != 0) { ++bad; continue; }
+            if (++k == APP_MAP_BLOCK) { rc = flush_text(&prog, k, &kernel_ns); values += k; k = 0; }
+        }
+        if (rc == 0 && k) { rc = flush_text(&prog, k, &kernel_ns); values += k; }
+    }
+    if (fflush(stdout) != 0) rc = -1;
+    const double secs = (double)(now_ns() - t0) / 1e9, ksecs = (double)kernel_ns / 1e9;
+    input_close(&in);
+
+    if (rc < 0) perror("map: write");
+    if (bad) fprintf(stderr, "map: %llu invalid numbers skipped\n", (unsigned long long)bad);
+    fprintf(stderr, "{\"values\":%llu,\"ops\":%d,\"isa\":\"%s\",\"elapsed_s\":%.3f,"
+                    "\"values_per_s\":%.0f,\"kernel_values_per_s\":%.0f}\n",
+            (unsigned long long)values, prog.n, calc_prog_isa(), secs,
+            secs > 0 ? (double)values / secs : 0.0, ksecs > 0 ? (double)values / ksecs : 0.0);
+    return rc < 0 ? 1 : 0;
+}
@@ -2,27 +2,37 @@
 #include "app_render_hello.h"
 #include "gfx.h"
 #include "ssd1306.h"
+#include "ssd1306_async.h"
+#include "widget.h"
 
 void app_render_hello(ssd1306_t *dev) {
     if (!dev) return;
 
-    ssd1306_clear(dev);
-
     // Choose the vertical center "text row": each row is 8 px tall.
-    const int rows = gfx_text_rows(dev);               // 128x64 → 8 rows
+    const int rows = gfx_text_rows(&dev->surface);   // 128x64 → 8 rows
     const int center_row = (rows - 1) / 2;
 
-    // Print centered
-    gfx_print_line(dev, "HELLO WORLD!", center_row, GFX_ALIGN_CENTER);
+    // One label per text row; a label owns its whole row, so each line gets its
+    // own (on a 4-row panel the later labels overwrite the earlier ones).
+    widget_label_t labels[5];
+    widget_label_init(&labels[0], center_row, GFX_ALIGN_CENTER);
+    widget_label_set(&labels[0], "HELLO WORLD!");
 
-    // Row indices are 0..gfx_text_rows(&dev)-1 (64px tall → 0..7)
-    gfx_print_line(dev, "LEFT ALIGNED",   0, GFX_ALIGN_LEFT);
-    gfx_print_line(dev, "CENTRE",         1, GFX_ALIGN_CENTER);   // alias: GFX_ALIGN_CENTRE
-    gfx_print_line(dev, "RIGHT ALIGNED",          2, GFX_ALIGN_RIGHT);
+    // Row indices are 0..gfx_text_rows(s)-1 (64px tall → 0..7)
+    widget_label_init(&labels[1], 0, GFX_ALIGN_LEFT);
+    widget_label_set(&labels[1], "LEFT ALIGNED");
+    widget_label_init(&labels[2], 1, GFX_ALIGN_CENTER);  // alias: GFX_ALIGN_CENTRE
+    widget_label_set(&labels[2], "CENTRE");
+    widget_label_init(&labels[3], 2, GFX_ALIGN_RIGHT);
+    widget_label_set(&labels[3], "RIGHT ALIGNED");
 
-    // Explicit x start (pixels from left)
-    gfx_print_line(dev, "X=12",           3, 12);
+    // Explicit x start (pixels from left), on the bottom row
+    widget_label_init(&labels[4], rows - 1, 12);
+    widget_label_set(&labels[4], "X=12");
+
+    ssd1306_clear(dev);
+    for (int i = 0; i < 5; ++i) widget_label_draw(&labels[i], &dev->surface);
 
-    // Push to the display once
-    ssd1306_update_full(dev);
-}
\ No newline at end of file
+    // Push the painted rows to the display once
+    ssd1306_submit(dev);
+}
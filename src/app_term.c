@@ -0,0 +1,156 @@
+// src/app_term.c
+#define _POSIX_C_SOURCE 200809L   // poll, clock_gettime
+#include "app_term.h"
+#include "gfx.h"
+#include "ssd1306.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef APP_TERM_MAX_LATENCY_MS
+#define APP_TERM_MAX_LATENCY_MS  50    // longest a line waits while input keeps coming
+#endif
+#define TERM_READ_CHUNK  4096
+#define TERM_TAB         4
+
+int app_term_init(app_term_t *t, ssd1306_t *dev) {
+    if (!t || !dev || !dev->buffer) return -1;
+    memset(t, 0, sizeof(*t));
+    t->dev  = dev;
+    t->rows = gfx_text_rows(&dev->surface);
+    t->cols = (int)dev->width / GFX_CHAR_ADVANCE;
+    if (t->cols > APP_TERM_COLS_MAX) t->cols = APP_TERM_COLS_MAX;
+    if (t->rows <= 0 || t->rows > SSD1306_MAX_PAGES || t->cols <= 0) return -2;
+
+    // The start line wraps over all 64 RAM rows, so the page ring only lines
+    // up with it when the panel shows every page.
+    t->hw_scroll = (t->rows == SSD1306_MAX_PAGES);
+
+    memset(t->text, ' ', sizeof(t->text));
+    memset(t->shown, ' ', sizeof(t->shown));    // a blank cell is a space glyph
+
+    ssd1306_clear(dev);
+    int rc = ssd1306_update_dirty(dev);
+    if (rc == 0 && t->hw_scroll) rc = ssd1306_set_start_line(dev, 0);
+    return rc < 0 ? rc : 0;
+}
+
+static void new_line(app_term_t *t) {
+    ++t->line;
+    t->col = 0;
+    memset(t->text[t->line % (uint32_t)t->rows], ' ', (size_t)t->cols);
+}
+
+static void put_char(app_term_t *t, char ch) {
+    if (t->nl_pending) { new_line(t); t->nl_pending = false; }
+    if (t->col >= t->cols) new_line(t);
+    t->text[t->line % (uint32_t)t->rows][t->col++] = ch;
+}
+
+void app_term_write(app_term_t *t, const char *s, size_t n) {
+    if (!t || !s) return;
+    for (size_t i = 0; i < n; ++i) {
+        const unsigned char ch = (unsigned char)s[i];
+        if (ch == '\n') {
+            // Scroll lazily so the newest line stays on the bottom row
+            if (t->nl_pending) new_line(t);
+            t->nl_pending = true;
+        } else if (ch == '\r') {
+            t->col = 0;
+        } else if (ch == '\t') {
+            do put_char(t, ' '); while (t->col % TERM_TAB && t->col < t->cols);
+        } else if (ch >= 0x20 && ch < 0x7F) {
+            put_char(t, (char)ch);
+        } else if (ch >= 0xC0) {
+            put_char(t, '?');           // UTF-8 lead byte: one cell per code point
+        }
+        // Other control bytes and UTF-8 continuation bytes take no cell
+    }
+}
+
+int app_term_flush(app_term_t *t) {
+    if (!t || !t->dev) return -1;
+    ssd1306_t *dev = t->dev;
+    const uint32_t rows = (uint32_t)t->rows;
+
+    // Once the console is full, the slot after the cursor line is the top row
+    const int top = (t->line + 1 > rows) ? (int)((t->line + 1) % rows) : 0;
+
+    for (int r = 0; r < t->rows; ++r) {
+        const int slot = (top + r) % t->rows;
+        const int page = t->hw_scroll ? slot : r;
+        const char *want = t->text[slot];
+        char *have = t->shown[page];
+        for (int c = 0; c < t->cols; ++c) {
+            if (want[c] == have[c]) continue;
+            gfx_draw_char(&dev->surface, c * GFX_CHAR_ADVANCE, page * 8, want[c]);
+            have[c] = want[c];
+            ++t->cells_sent;
+        }
+    }
+
+    // New text first, then the scroll that brings it into view
+    int rc = ssd1306_update_dirty(dev);
+    if (rc == 0 && t->hw_scroll && top != t->top_shown) {
+        rc = ssd1306_set_start_line(dev, (uint8_t)(top * 8));
+        if (rc == 0) t->top_shown = top;
+    }
+    ++t->flushes;
+    return rc < 0 ? rc : 0;
+}
+
+static uint64_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)(ts.tv_nsec / 1000000);
+}
+
+int app_run_term(ssd1306_t *dev, int fd) {
+    app_term_t t;
+    int rc = app_term_init(&t, dev);
+    if (rc < 0) return rc;
+
+    char     buf[TERM_READ_CHUNK];
+    bool     pending = false;           // written but not yet flushed
+    uint64_t deadline = 0;
+
+    for (;;) {
+        int timeout = -1;
+        if (pending) {
+            const uint64_t now = now_ms();
+            timeout = (now >= deadline) ? 0 : (int)(deadline - now);
+        }
+
+        struct pollfd pfd = { .fd = fd, .events = POLLIN };
+        const int r = poll(&pfd, 1, timeout);
+        if (r < 0) {
+            if (errno == EINTR) continue;
+            rc = -3;
+            break;
+        }
+        if (r > 0) {
+            const ssize_t n = read(fd, buf, sizeof(buf));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) { if (n < 0) rc = -3; break; }   // EOF or read error
+            app_term_write(&t, buf, (size_t)n);
+            if (!pending) { pending = true; deadline = now_ms() + APP_TERM_MAX_LATENCY_MS; }
+            if (now_ms() < deadline) continue;          // keep draining the burst
+        }
+
+        // Input went idle or the latency budget ran out: one flush for all of it
+        if (pending) {
+            const int frc = app_term_flush(&t);
+            if (frc < 0) rc = frc;
+            pending = false;
+        }
+    }
+
+    if (pending) {
+        const int frc = app_term_flush(&t);
+        if (frc < 0 && rc == 0) rc = frc;
+    }
+    return rc;
+}
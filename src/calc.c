@@ -0,0 +1,283 @@
+// src/calc.c
+// Calculator core: token parsing and value formatting. No I/O, no display.
+#include "calc.h"
+
+#include <ctype.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+// ---------- Small string helpers ----------
+void calc_strtrim(char *s) {
+    if (!s) return;
+    size_t i = 0; while (s[i] && isspace((unsigned char)s[i])) ++i;
+    if (i) memmove(s, s + i, strlen(s + i) + 1);
+    size_t n = strlen(s);
+    while (n && isspace((unsigned char)s[n - 1])) s[--n] = '\0';
+}
+
+// ---------- Tokenizer ----------
+static bool is_space(char ch) {
+    return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r' || ch == '\v' || ch == '\f';
+}
+
+size_t calc_next_token(const char **pos, const char *end, const char **tok) {
+    const char *p = *pos;
+    while (p < end && is_space(*p)) ++p;
+    const char *start = p;
+    while (p < end && !is_space(*p)) ++p;
+    *tok = start;
+    *pos = p;
+    return (size_t)(p - start);
+}
+
+// ---------- Number parsing ----------
+// Digit value + 1 per byte for [0-9A-Fa-f], DIG_SEP for '_', 0 for anything else.
+#define DIG_SEP  0x80
+static const uint8_t DIGIT[256] = {
+    ['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5,
+    ['5'] = 6, ['6'] = 7, ['7'] = 8, ['8'] = 9, ['9'] = 10,
+    ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+    ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+    ['_'] = DIG_SEP,
+};
+
+// One pass over s[0..n) in base 2, 10 or 16; '_' separators are skipped.
+// Errors: -2 no digits, -3 bad character, -4 does not fit in 64 bits.
+static int parse_digits(const char *s, size_t n, unsigned base, uint64_t *out) {
+    uint64_t v = 0;
+    unsigned digits = 0;        // significant digits (hex/bin limits count these)
+    for (size_t i = 0; i < n; ++i) {
+        const uint8_t e = DIGIT[(uint8_t)s[i]];
+        if (e == DIG_SEP) continue;
+        const unsigned d = (unsigned)e - 1u;      // wraps to UINT_MAX for bad bytes
+        if (d >= base) return -3;
+        ++digits;
+        if (base == 10) {
+            if (v > (UINT64_MAX - d) / 10u) return -4;
+            v = v * 10u + d;
+        } else if (base == 16) {
+            v = (v << 4) | d;
+        } else {
+            v = (v << 1) | d;
+        }
+    }
+    if (!digits) return -2;
+    if ((base == 16 && digits > 16) || (base == 2 && digits > 64)) return -4;
+    *out = v; return 0;
+}
+
+int calc_parse_num64n(const char *s, size_t n, uint64_t *out) {
+    if (!s || !out || n == 0) return -1;
+    if (n >= 2 && s[0] == '0') {
+        switch (s[1]) {
+            case 'x': case 'X': return parse_digits(s + 2, n - 2, 16, out);
+            case 'b': case 'B': return parse_digits(s + 2, n - 2, 2, out);
+            case 'd': case 'D': return parse_digits(s + 2, n - 2, 10, out);
+            default: break;
+        }
+    }
+    return parse_digits(s, n, 10, out); // default decimal
+}
+
+int calc_parse_num64(const char *token, uint64_t *out) {
+    if (!token) return -1;
+    return calc_parse_num64n(token, strlen(token), out);
+}
+
+// ---------- Formatting ----------
+void calc_fmt_hex64(uint64_t v, char out[CALC_HEX_LEN]) {
+    static const char HEX[] = "0123456789ABCDEF";
+    char raw[16];
+    for (int i = 0; i < 16; ++i) { raw[15 - i] = HEX[(uint8_t)(v & 0xF)]; v >>= 4; }
+    char *o = out; *o++='0'; *o++='x';
+    for (int i = 0; i < 16; ++i) { *o++ = raw[i]; if (i==3||i==7||i==11) *o++ = '_'; }
+    *o = '\0';
+}
+
+void calc_fmt_dec64(uint64_t v, char out[CALC_DEC_LEN]) {
+    snprintf(out, CALC_DEC_LEN, "%" PRIu64, v);
+}
+
+// Show tail 16 bits; prefix "0b" and ellipsis if higher bits present.
+void calc_fmt_bin_tail16(uint64_t v, char out[CALC_BIN_LEN]) {
+    char *o = out;
+    *o++='0'; *o++='b';
+    if ((v >> 16) != 0) { *o++='.'; *o++='.'; *o++='.'; }
+    for (int i = 15; i >= 0; --i) *o++ = ((v >> i) & 1u) ? '1' : '0';
+    *o = '\0';
+}
+
+// ---------- Operator parsing ----------
+// Perfect hash by length: each length has at most a handful of candidates,
+// told apart by one switch on the lower-cased bytes packed into an integer.
+// (c | 0x20) folds ASCII letters to lower case and cannot alias a letter from
+// a non-letter, so the packed compare is an exact case-insensitive match.
+#define K2(a, b)        ((uint32_t)(uint8_t)(a) | (uint32_t)(uint8_t)(b) << 8)
+#define K3(a, b, c)     (K2(a, b) | (uint32_t)(uint8_t)(c) << 16)
+
+op_t calc_parse_operator_n(const char *t, size_t n) {
+    if (!t) return OP_NONE;
+    switch (n) {
+        case 1:
+            switch (t[0]) {
+                case '+': return OP_ADD;
+                case '-': return OP_SUB;
+                case '&': return OP_AND;
+                case '|': return OP_OR;
+                case '^': return OP_XOR;
+                case '~': return OP_INVERT;
+                default:  return OP_NONE;
+            }
+        case 2:
+            switch (K2(t[0], t[1])) {
+                case K2('<', '<'): return OP_SHL;
+                case K2('>', '>'): return OP_SHR;
+                default: break;
+            }
+            return (K2(t[0] | 0x20, t[1] | 0x20) == K2('o', 'r')) ? OP_OR : OP_NONE;
+        case 3:
+            switch (K3(t[0] | 0x20, t[1] | 0x20, t[2] | 0x20)) {
+                case K3('a', 'd', 'd'): return OP_ADD;
+                case K3('a', 'n', 'd'): return OP_AND;
+                case K3('x', 'o', 'r'): return OP_XOR;
+                case K3('h', 'e', 'x'): return OP_SHOW_HEX;
+                case K3('d', 'e', 'c'): return OP_SHOW_DEC;
+                case K3('b', 'i', 'n'): return OP_SHOW_BIN;
+                default: return OP_NONE;
+            }
+        case 6:
+            for (size_t i = 0; i < 6; ++i) if ((t[i] | 0x20) != "invert"[i]) return OP_NONE;
+            return OP_INVERT;
+        case 8:
+            for (size_t i = 0; i < 8; ++i) if ((t[i] | 0x20) != "subtract"[i]) return OP_NONE;
+            return OP_SUB;
+        default:
+            return OP_NONE;
+    }
+}
+
+op_t calc_parse_operator(const char *token) {
+    if (!token) return OP_NONE;
+    return calc_parse_operator_n(token, strlen(token));
+}
+
+const char* calc_op_label(op_t op) {
+    switch (op) {
+        case OP_ADD: return "add";
+        case OP_SUB: return "subtract";
+        case OP_AND: return "and";
+        case OP_OR:  return "or";
+        case OP_XOR: return "xor";
+        case OP_SHL: return "<<";
+        case OP_SHR: return ">>";
+        case OP_INVERT: return "invert";
+        case OP_SHOW_HEX: return "display hex";
+        case OP_SHOW_DEC: return "display dec";
+        case OP_SHOW_BIN: return "display bin";
+        default: return "";
+    }
+}
+
+bool calc_is_binary_op(op_t op) {
+    return (op == OP_ADD || op == OP_SUB || op == OP_AND || op == OP_OR ||
+            op == OP_XOR || op == OP_SHL || op == OP_SHR);
+}
+
+// ---------- State machine ----------
+void calc_init(calc_t *c) {
+    if (!c) return;
+    c->result      = 0;
+    c->state       = ST_EXPECT_ANY;
+    c->pending     = OP_NONE;
+    c->disp        = DISP_HEX;
+    c->show_op     = false;
+    c->op_name     = "";
+    c->last_was_op = false;
+    c->input_line[0] = '\0';
+}
+
+// Remember input as-typed. Only tokens that row 0 can show (values and 'c')
+// are copied; operators hide row 0 so they skip the copy.
+static void remember_input(calc_t *c, const char *token, size_t n) {
+    if (n > sizeof(c->input_line) - 1) n = sizeof(c->input_line) - 1;
+    memcpy(c->input_line, token, n);
+    c->input_line[n] = '\0';
+}
+
+calc_status_t calc_feed(calc_t *c, const char *token) {
+    if (!token) return CALC_EMPTY;
+    return calc_feed_n(c, token, strlen(token));
+}
+
+calc_status_t calc_feed_n(calc_t *c, const char *token, size_t n) {
+    if (!c || !token || n == 0) return CALC_EMPTY;
+
+    // Quit / Clear
+    if (n == 1 && (token[0]=='q'||token[0]=='Q')) return CALC_QUIT;
+    if (n == 1 && (token[0]=='c'||token[0]=='C')) {
+        remember_input(c, token, n);
+        c->result  = 0;
+        c->state   = ST_EXPECT_ANY;
+        c->pending = OP_NONE;
+        c->show_op = false; c->op_name = "";
+        c->last_was_op = false; // immediate load
+        return CALC_OK;
+    }
+
+    // Operator?
+    op_t op = calc_parse_operator_n(token, n);
+    if (op != OP_NONE) {
+        // These are operations → don't show token on row 0
+        c->last_was_op = true;
+        c->show_op = true;
+        c->op_name = calc_op_label(op);
+
+        if (op == OP_SHOW_HEX || op == OP_SHOW_DEC || op == OP_SHOW_BIN) {
+            c->disp = (op == OP_SHOW_HEX) ? DISP_HEX : (op == OP_SHOW_DEC ? DISP_DEC : DISP_BIN);
+            return CALC_OK;
+        }
+        if (op == OP_INVERT) {
+            c->result = ~c->result;
+            c->state = ST_EXPECT_ANY; c->pending = OP_NONE;
+            return CALC_OK;
+        }
+        // Binary operator: set pending and wait for arg
+        c->pending = op;
+        c->state = ST_EXPECT_ARG;
+        return CALC_OK;
+    }
+
+    // Number?
+    uint64_t arg = 0;
+    if (calc_parse_num64n(token, n, &arg) != 0) return CALC_BAD_NUMBER;
+
+    // Now the last token is a value → show it on row 0
+    remember_input(c, token, n);
+    c->last_was_op = false;
+
+    if (c->state == ST_EXPECT_ANY) {
+        // Immediate load
+        c->result  = arg;
+        c->pending = OP_NONE;
+        c->show_op = false; c->op_name = "";   // blank on immediate load
+        return CALC_OK;
+    }
+
+    // Apply pending binary op with this arg
+    uint8_t sh = (uint8_t)(arg & 63u);  // clamp shift 0..63
+    switch (c->pending) {
+        case OP_ADD: c->result = (uint64_t)(c->result + arg); break;
+        case OP_SUB: c->result = (uint64_t)(c->result - arg); break;
+        case OP_AND: c->result = (uint64_t)(c->result & arg); break;
+        case OP_OR:  c->result = (uint64_t)(c->result | arg); break;
+        case OP_XOR: c->result = (uint64_t)(c->result ^ arg); break;
+        case OP_SHL: c->result = (c->result << sh); break;
+        case OP_SHR: c->result = (c->result >> sh); break;
+        default: break;
+    }
+    c->state   = ST_EXPECT_ANY;
+    c->pending = OP_NONE;
+    // Keep OPERATION visible (do not blank it here)
+    return CALC_OK;
+}
@@ -0,0 +1,178 @@
+// src/calc_journal.c
+// Memory-mapped calculator session journal (see calc_journal.h).
+#define _POSIX_C_SOURCE 200809L   // ftruncate, pread
+#include "calc_journal.h"
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define JREC_SHOW_OP      0x01
+#define JREC_LAST_WAS_OP  0x02
+
+typedef struct {
+    uint64_t seq;                       // 0: never written
+    uint64_t result;
+    uint8_t  state, pending, disp;
+    uint8_t  op;                        // op whose label is shown, OP_NONE for none
+    uint8_t  flags;                     // JREC_*
+    uint8_t  input_len;
+    char     input[CALC_JOURNAL_INPUT_MAX];
+} jrec_t;
+
+typedef struct {
+    char     magic[8];
+    uint32_t rec_size, capacity;
+    uint64_t first, cur, last;
+    uint8_t  reserved[24];
+} jhdr_t;
+
+_Static_assert(sizeof(jrec_t) == 64, "journal records are 64 bytes");
+_Static_assert(sizeof(jhdr_t) == 64, "journal header is 64 bytes");
+
+struct calc_journal {
+    jhdr_t  *hdr;                       // start of the mapping
+    jrec_t  *rec;                       // hdr + 1
+    size_t   map_len;
+};
+
+// ---------- Record <-> state ----------
+// calc_t keeps the shown label as a pointer to calc_op_label(op); map it back.
+static op_t label_op(const char *label) {
+    for (int op = OP_ADD; op <= OP_SHOW_BIN; ++op)
+        if (label == calc_op_label((op_t)op)) return (op_t)op;
+    return OP_NONE;
+}
+
+static void pack(jrec_t *r, const calc_t *c) {
+    memset(r, 0, sizeof(*r));
+    r->result  = c->result;
+    r->state   = (uint8_t)c->state;
+    r->pending = (uint8_t)c->pending;
+    r->disp    = (uint8_t)c->disp;
+    r->op      = (uint8_t)label_op(c->op_name);
+    r->flags   = (uint8_t)((c->show_op ? JREC_SHOW_OP : 0) | (c->last_was_op ? JREC_LAST_WAS_OP : 0));
+    const size_t n = strnlen(c->input_line, CALC_JOURNAL_INPUT_MAX - 1);
+    memcpy(r->input, c->input_line, n);
+    r->input_len = (uint8_t)n;
+}
+
+// Out-of-range fields (a damaged file) fall back to their power-on values.
+static void unpack(const jrec_t *r, calc_t *c) {
+    const size_t n = r->input_len < CALC_JOURNAL_INPUT_MAX ? r->input_len : 0;
+    c->result      = r->result;
+    c->state       = r->state <= ST_EXPECT_ARG ? (calc_state_t)r->state : ST_EXPECT_ANY;
+    c->pending     = r->pending <= OP_SHOW_BIN ? (op_t)r->pending : OP_NONE;
+    c->disp        = r->disp <= DISP_BIN ? (display_mode_t)r->disp : DISP_HEX;
+    c->op_name     = calc_op_label((op_t)r->op);
+    c->show_op     = (r->flags & JREC_SHOW_OP) != 0;
+    c->last_was_op = (r->flags & JREC_LAST_WAS_OP) != 0;
+    memcpy(c->input_line, r->input, n);
+    c->input_line[n] = '\0';
+}
+
+static const jrec_t *slot(const calc_journal_t *j, uint64_t seq) {
+    const jrec_t *r = &j->rec[seq % j->hdr->capacity];
+    return (seq && r->seq == seq) ? r : NULL;
+}
+
+// ---------- Public API ----------
+int calc_journal_open(calc_journal_t **out, const char *path, uint32_t capacity) {
+    if (!out || !path) return -1;
+    *out = NULL;
+    if (!capacity) capacity = CALC_JOURNAL_CAPACITY;
+    const size_t len = sizeof(jhdr_t) + (size_t)capacity * sizeof(jrec_t);
+
+    const int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return -2;
+    struct stat st;
+    if (fstat(fd, &st) != 0) { close(fd); return -2; }
+
+    // Only a new (empty) file or one that already is a journal may be written:
+    // anything else is someone's data, not ours to truncate
+    char magic[8];
+    const bool empty = st.st_size == 0;
+    if (!empty && (pread(fd, magic, sizeof(magic), 0) != (ssize_t)sizeof(magic) ||
+                   memcmp(magic, CALC_JOURNAL_MAGIC, 8) != 0)) {
+        close(fd);
+        return -4;
+    }
+    const bool sized = (size_t)st.st_size == len;
+    if (!sized && (ftruncate(fd, 0) != 0 || ftruncate(fd, (off_t)len) != 0)) { close(fd); return -2; }
+    void *map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return -3;
+
+    calc_journal_t *j = (calc_journal_t *)calloc(1, sizeof(*j));
+    if (!j) { munmap(map, len); return -3; }
+    j->hdr = (jhdr_t *)map;
+    j->rec = (jrec_t *)(j->hdr + 1);
+    j->map_len = len;
+
+    // A new file, or a journal of another shape or with a damaged header, starts empty
+    jhdr_t *h = j->hdr;
+    if (memcmp(h->magic, CALC_JOURNAL_MAGIC, 8) != 0 || h->rec_size != sizeof(jrec_t) ||
+        h->capacity != capacity || h->cur < h->first || h->cur > h->last) {
+        memset(map, 0, len);
+        memcpy(h->magic, CALC_JOURNAL_MAGIC, 8);
+        h->rec_size = sizeof(jrec_t);
+        h->capacity = capacity;
+    }
+    *out = j;
+    return 0;
+}
+
+void calc_journal_close(calc_journal_t *j) {
+    if (!j) return;
+    munmap(j->hdr, j->map_len);
+    free(j);
+}
+
+bool calc_journal_restore(const calc_journal_t *j, calc_t *c) {
+    if (!j || !c) return false;
+    const jrec_t *r = slot(j, j->hdr->cur);
+    if (!r) return false;
+    unpack(r, c);
+    return true;
+}
+
+void calc_journal_record(calc_journal_t *j, const calc_t *c) {
+    if (!j || !c) return;
+    jhdr_t *h = j->hdr;
+    jrec_t r;
+    pack(&r, c);
+    const jrec_t *now = slot(j, h->cur);
+    r.seq = h->cur;
+    if (now && memcmp(now, &r, sizeof(r)) == 0) return;
+
+    // Write the record, then publish it: a crash in between keeps the old state
+    r.seq = h->cur + 1;
+    j->rec[r.seq % h->capacity] = r;
+    atomic_thread_fence(memory_order_release);
+    h->last = h->cur = r.seq;
+    if (!h->first) h->first = r.seq;
+    if (h->last - h->first >= h->capacity) h->first = h->last - h->capacity + 1;
+}
+
+bool calc_journal_undo(calc_journal_t *j, calc_t *c) {
+    if (!j || !c) return false;
+    jhdr_t *h = j->hdr;
+    const jrec_t *r = h->cur > h->first ? slot(j, h->cur - 1) : NULL;
+    if (!r) return false;
+    unpack(r, c);
+    h->cur--;
+    return true;
+}
+
+bool calc_journal_redo(calc_journal_t *j, calc_t *c) {
+    if (!j || !c) return false;
+    jhdr_t *h = j->hdr;
+    const jrec_t *r = h->cur < h->last ? slot(j, h->cur + 1) : NULL;
+    if (!r) return false;
+    unpack(r, c);
+    h->cur++;
+    return true;
+}
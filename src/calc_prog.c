@@ -0,0 +1,143 @@
+// src/calc_prog.c
+// Calculator expression compiler and array kernels (see calc_prog.h).
+#include "calc_prog.h"
+#include <string.h>
+
+// Values per pass: every op runs over one block while it sits in L1, so the
+// op dispatch is paid once per block and each pass is a plain vector loop.
+#ifndef CALC_PROG_BLOCK
+#define CALC_PROG_BLOCK  512
+#endif
+
+// x86-64 builds carry an AVX2 clone of the kernel picked at load time; the
+// default clone is SSE2, which every x86-64 CPU has.
+#if CALC_PROG_VECTOR && defined(__x86_64__) && defined(__linux__)
+#define CALC_PROG_CLONES  __attribute__((target_clones("avx2", "default")))
+#else
+#define CALC_PROG_CLONES
+#endif
+
+// ---------- Compiler ----------
+// Append 'op arg', merged into the previous op where the two combine.
+static int emit(calc_prog_t *p, op_t op, uint64_t arg) {
+    if (op == OP_SUB) { op = OP_ADD; arg = (uint64_t)0 - arg; }
+    if (op == OP_SHL || op == OP_SHR) arg &= 63u;
+
+    // Shifts clamp per step, so consecutive shifts do not add up
+    calc_insn_t *last = p->n ? &p->insn[p->n - 1] : NULL;
+    if (last && last->op == op && op != OP_SHL && op != OP_SHR) {
+        switch (op) {
+            case OP_ADD: last->arg += arg; break;
+            case OP_AND: last->arg &= arg; break;
+            case OP_OR:  last->arg |= arg; break;
+            default:     last->arg ^= arg; break;
+        }
+        op = last->op; arg = last->arg;
+        --p->n;                         // re-appended below unless it became a no-op
+    }
+    if ((op == OP_AND && arg == UINT64_MAX) || (op != OP_AND && arg == 0)) return 0;
+    if (p->n == CALC_PROG_MAX) return -3;
+    p->insn[p->n++] = (calc_insn_t){ op, arg };
+    return 0;
+}
+
+int calc_prog_compile(calc_prog_t *p, const char *src, size_t len, size_t *err_at) {
+    if (!p || (!src && len)) return -1;
+    p->n = 0;
+    p->disp = DISP_HEX;
+
+    const char *pos = src, *end = src + len, *tok;
+    size_t n;
+    int rc = 0;
+    while (rc == 0 && (n = calc_next_token(&pos, end, &tok)) != 0) {
+        const op_t op = calc_parse_operator_n(tok, n);
+        if (op == OP_SHOW_HEX || op == OP_SHOW_DEC || op == OP_SHOW_BIN) {
+            p->disp = (op == OP_SHOW_HEX) ? DISP_HEX : (op == OP_SHOW_DEC ? DISP_DEC : DISP_BIN);
+        } else if (op == OP_INVERT) {
+            rc = emit(p, OP_XOR, UINT64_MAX);
+        } else if (calc_is_binary_op(op)) {
+            const char *arg_tok;
+            const size_t an = calc_next_token(&pos, end, &arg_tok);
+            uint64_t arg;
+            if (an == 0 || calc_parse_num64n(arg_tok, an, &arg) != 0) { rc = -2; if (an) tok = arg_tok; }
+            else rc = emit(p, op, arg);
+        } else {
+            rc = -1;
+        }
+        if (rc < 0 && err_at) *err_at = (size_t)(tok - src);
+    }
+    return rc;
+}
+
+uint64_t calc_prog_eval(const calc_prog_t *p, uint64_t v) {
+    for (int i = 0; i < p->n; ++i) {
+        const uint64_t a = p->insn[i].arg;
+        switch (p->insn[i].op) {
+            case OP_ADD: v += a; break;
+            case OP_AND: v &= a; break;
+            case OP_OR:  v |= a; break;
+            case OP_XOR: v ^= a; break;
+            case OP_SHL: v <<= a; break;
+            case OP_SHR: v >>= a; break;
+            default: break;
+        }
+    }
+    return v;
+}
+
+// ---------- Kernels ----------
+#if CALC_PROG_VECTOR
+typedef uint64_t v4u64 __attribute__((vector_size(32)));
+
+// dst[i] = EXPR(x = src[i]); EXPR is written once and used for both the
+// vector body (x a v4u64, arguments broadcast) and the scalar tail.
+#define MAP(EXPR) do {                                                          \
+    size_t i = 0;                                                               \
+    for (; i + 4 <= n; i += 4) {                                                \
+        v4u64 x;                                                                \
+        memcpy(&x, &src[i], sizeof(x));                                         \
+        x = (EXPR);                                                             \
+        memcpy(&dst[i], &x, sizeof(x));                                         \
+    }                                                                           \
+    for (; i < n; ++i) { const uint64_t x = src[i]; dst[i] = (EXPR); }          \
+} while (0)
+#else
+#define MAP(EXPR) do {                                                          \
+    for (size_t i = 0; i < n; ++i) { const uint64_t x = src[i]; dst[i] = (EXPR); } \
+} while (0)
+#endif
+
+CALC_PROG_CLONES
+static void run_insn(calc_insn_t k, const uint64_t *src, uint64_t *dst, size_t n) {
+    const uint64_t a = k.arg;
+    switch (k.op) {
+        case OP_ADD: MAP(x + a); break;
+        case OP_AND: MAP(x & a); break;
+        case OP_OR:  MAP(x | a); break;
+        case OP_XOR: MAP(x ^ a); break;
+        case OP_SHL: MAP(x << a); break;
+        case OP_SHR: MAP(x >> a); break;
+        default:     if (dst != src) memcpy(dst, src, n * sizeof(*dst)); break;
+    }
+}
+
+void calc_prog_run(const calc_prog_t *p, const uint64_t *in, uint64_t *out, size_t n) {
+    if (!p || !in || !out) return;
+    if (p->n == 0) { if (out != in) memcpy(out, in, n * sizeof(*out)); return; }
+    for (size_t at = 0; at < n; at += CALC_PROG_BLOCK) {
+        const size_t m = (n - at < CALC_PROG_BLOCK) ? n - at : CALC_PROG_BLOCK;
+        // The first op reads the input, the rest work in place on the output
+        run_insn(p->insn[0], &in[at], &out[at], m);
+        for (int i = 1; i < p->n; ++i) run_insn(p->insn[i], &out[at], &out[at], m);
+    }
+}
+
+const char* calc_prog_isa(void) {
+#if CALC_PROG_VECTOR && defined(__x86_64__) && defined(__linux__)
+    return __builtin_cpu_supports("avx2") ? "avx2" : "sse2";
+#elif CALC_PROG_VECTOR
+    return "vector";
+#else
+    return "scalar";
+#endif
+}
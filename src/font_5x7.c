@@ -0,0 +1,678 @@
+// Generated by tools/bdf2c from fonts/5x7.bdf -- do not edit; rerun `make fonts`.
+#include "gfx_font.h"
+
+static const uint8_t COLS[570] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x00,0x00,0x00,0x00,0x07,0x00,0x07,
+    0x00,0x00,0x14,0x7F,0x14,0x7F,0x14,0x00,0x24,0x2A,0x7F,0x2A,0x12,0x00,0x23,0x13,
+    0x08,0x64,0x62,0x00,0x36,0x49,0x55,0x22,0x50,0x00,0x00,0x05,0x03,0x00,0x00,0x00,
+    0x00,0x1C,0x22,0x41,0x00,0x00,0x00,0x41,0x22,0x1C,0x00,0x00,0x14,0x08,0x3E,0x08,
+    0x14,0x00,0x08,0x08,0x3E,0x08,0x08,0x00,0x00,0x50,0x30,0x00,0x00,0x00,0x08,0x08,
+    0x08,0x08,0x08,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x20,0x10,0x08,0x04,0x02,0x00,
+    0x3E,0x51,0x49,0x45,0x3E,0x00,0x00,0x42,0x7F,0x40,0x00,0x00,0x42,0x61,0x51,0x49,
+    0x46,0x00,0x21,0x41,0x45,0x4B,0x31,0x00,0x18,0x14,0x12,0x7F,0x10,0x00,0x27,0x45,
+    0x45,0x45,0x39,0x00,0x3C,0x4A,0x49,0x49,0x30,0x00,0x01,0x71,0x09,0x05,0x03,0x00,
+    0x36,0x49,0x49,0x49,0x36,0x00,0x06,0x49,0x49,0x29,0x1E,0x00,0x00,0x36,0x36,0x00,
+    0x00,0x00,0x00,0x56,0x36,0x00,0x00,0x00,0x08,0x14,0x22,0x41,0x00,0x00,0x14,0x14,
+    0x14,0x14,0x14,0x00,0x00,0x41,0x22,0x14,0x08,0x00,0x02,0x01,0x51,0x09,0x06,0x00,
+    0x32,0x49,0x79,0x41,0x3E,0x00,0x7E,0x11,0x11,0x11,0x7E,0x00,0x7F,0x49,0x49,0x49,
+    0x36,0x00,0x3E,0x41,0x41,0x41,0x22,0x00,0x7F,0x41,0x41,0x22,0x1C,0x00,0x7F,0x49,
+    0x49,0x49,0x41,0x00,0x7F,0x09,0x09,0x09,0x01,0x00,0x3E,0x41,0x49,0x49,0x7A,0x00,
+    0x7F,0x08,0x08,0x08,0x7F,0x00,0x00,0x41,0x7F,0x41,0x00,0x00,0x20,0x40,0x41,0x3F,
+    0x01,0x00,0x7F,0x08,0x14,0x22,0x41,0x00,0x7F,0x40,0x40,0x40,0x40,0x00,0x7F,0x02,
+    0x0C,0x02,0x7F,0x00,0x7F,0x04,0x08,0x10,0x7F,0x00,0x3E,0x41,0x41,0x41,0x3E,0x00,
+    0x7F,0x09,0x09,0x09,0x06,0x00,0x3E,0x41,0x51,0x21,0x5E,0x00,0x7F,0x09,0x19,0x29,
+    0x46,0x00,0x46,0x49,0x49,0x49,0x31,0x00,0x01,0x01,0x7F,0x01,0x01,0x00,0x3F,0x40,
+    0x40,0x40,0x3F,0x00,0x1F,0x20,0x40,0x20,0x1F,0x00,0x7F,0x20,0x18,0x20,0x7F,0x00,
+    0x63,0x14,0x08,0x14,0x63,0x00,0x07,0x08,0x70,0x08,0x07,0x00,0x61,0x51,0x49,0x45,
+    0x43,0x00,0x00,0x7F,0x41,0x41,0x00,0x00,0x02,0x04,0x08,0x10,0x20,0x00,0x00,0x41,
+    0x41,0x7F,0x00,0x00,0x04,0x02,0x01,0x02,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x03,0x05,0x00,0x00,0x00,0x20,0x54,0x54,0x54,0x78,0x00,0x7F,0x48,0x44,0x44,
+    0x38,0x00,0x38,0x44,0x44,0x44,0x20,0x00,0x38,0x44,0x44,0x48,0x7F,0x00,0x38,0x54,
+    0x54,0x54,0x18,0x00,0x08,0x7E,0x09,0x01,0x02,0x00,0x08,0x54,0x54,0x54,0x3C,0x00,
+    0x7F,0x08,0x04,0x04,0x78,0x00,0x00,0x44,0x7D,0x40,0x00,0x00,0x20,0x40,0x44,0x3D,
+    0x00,0x00,0x7F,0x10,0x28,0x44,0x00,0x00,0x00,0x41,0x7F,0x40,0x00,0x00,0x7C,0x04,
+    0x18,0x04,0x78,0x00,0x7C,0x08,0x04,0x04,0x78,0x00,0x38,0x44,0x44,0x44,0x38,0x00,
+    0x7C,0x14,0x14,0x14,0x08,0x00,0x08,0x14,0x14,0x14,0x7C,0x00,0x7C,0x08,0x04,0x04,
+    0x08,0x00,0x48,0x54,0x54,0x54,0x20,0x00,0x04,0x3F,0x44,0x40,0x20,0x00,0x3C,0x40,
+    0x40,0x20,0x7C,0x00,0x1C,0x20,0x40,0x20,0x1C,0x00,0x3C,0x40,0x30,0x40,0x3C,0x00,
+    0x44,0x28,0x10,0x28,0x44,0x00,0x0C,0x50,0x50,0x50,0x3C,0x00,0x44,0x64,0x54,0x4C,
+    0x44,0x00,0x00,0x08,0x36,0x41,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x41,
+    0x36,0x08,0x00,0x00,0x10,0x08,0x08,0x10,0x08,0x00,
+};
+
+#if GFX_FONT_SHIFTED
+static const uint8_t SHIFT1[1140] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,
+    0x00,0x00,0x00,0x00,0x28,0x00,0xFE,0x00,0x28,0x00,0xFE,0x00,0x28,0x00,0x00,0x00,
+    0x48,0x00,0x54,0x00,0xFE,0x00,0x54,0x00,0x24,0x00,0x00,0x00,0x46,0x00,0x26,0x00,
+    0x10,0x00,0xC8,0x00,0xC4,0x00,0x00,0x00,0x6C,0x00,0x92,0x00,0xAA,0x00,0x44,0x00,
+    0xA0,0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x38,0x00,0x44,0x00,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,
+    0x44,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x10,0x00,0x7C,0x00,0x10,0x00,
+    0x28,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x7C,0x00,0x10,0x00,0x10,0x00,0x00,0x00,
+    0x00,0x00,0xA0,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,
+    0x10,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x00,0x00,
+    0x7C,0x00,0xA2,0x00,0x92,0x00,0x8A,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x84,0x00,
+    0xFE,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x84,0x00,0xC2,0x00,0xA2,0x00,0x92,0x00,
+    0x8C,0x00,0x00,0x00,0x42,0x00,0x82,0x00,0x8A,0x00,0x96,0x00,0x62,0x00,0x00,0x00,
+    0x30,0x00,0x28,0x00,0x24,0x00,0xFE,0x00,0x20,0x00,0x00,0x00,0x4E,0x00,0x8A,0x00,
+    0x8A,0x00,0x8A,0x00,0x72,0x00,0x00,0x00,0x78,0x00,0x94,0x00,0x92,0x00,0x92,0x00,
+    0x60,0x00,0x00,0x00,0x02,0x00,0xE2,0x00,0x12,0x00,0x0A,0x00,0x06,0x00,0x00,0x00,
+    0x6C,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x6C,0x00,0x00,0x00,0x0C,0x00,0x92,0x00,
+    0x92,0x00,0x52,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x6C,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x28,0x00,0x44,0x00,0x82,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x28,0x00,
+    0x28,0x00,0x28,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x82,0x00,0x44,0x00,0x28,0x00,
+    0x10,0x00,0x00,0x00,0x04,0x00,0x02,0x00,0xA2,0x00,0x12,0x00,0x0C,0x00,0x00,0x00,
+    0x64,0x00,0x92,0x00,0xF2,0x00,0x82,0x00,0x7C,0x00,0x00,0x00,0xFC,0x00,0x22,0x00,
+    0x22,0x00,0x22,0x00,0xFC,0x00,0x00,0x00,0xFE,0x00,0x92,0x00,0x92,0x00,0x92,0x00,
+    0x6C,0x00,0x00,0x00,0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x44,0x00,0x00,0x00,
+    0xFE,0x00,0x82,0x00,0x82,0x00,0x44,0x00,0x38,0x00,0x00,0x00,0xFE,0x00,0x92,0x00,
+    0x92,0x00,0x92,0x00,0x82,0x00,0x00,0x00,0xFE,0x00,0x12,0x00,0x12,0x00,0x12,0x00,
+    0x02,0x00,0x00,0x00,0x7C,0x00,0x82,0x00,0x92,0x00,0x92,0x00,0xF4,0x00,0x00,0x00,
+    0xFE,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x82,0x00,
+    0xFE,0x00,0x82,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x80,0x00,0x82,0x00,0x7E,0x00,
+    0x02,0x00,0x00,0x00,0xFE,0x00,0x10,0x00,0x28,0x00,0x44,0x00,0x82,0x00,0x00,0x00,
+    0xFE,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0xFE,0x00,0x04,0x00,
+    0x18,0x00,0x04,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x08,0x00,0x10,0x00,0x20,0x00,
+    0xFE,0x00,0x00,0x00,0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x7C,0x00,0x00,0x00,
+    0xFE,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x0C,0x00,0x00,0x00,0x7C,0x00,0x82,0x00,
+    0xA2,0x00,0x42,0x00,0xBC,0x00,0x00,0x00,0xFE,0x00,0x12,0x00,0x32,0x00,0x52,0x00,
+    0x8C,0x00,0x00,0x00,0x8C,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x62,0x00,0x00,0x00,
+    0x02,0x00,0x02,0x00,0xFE,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x7E,0x00,0x80,0x00,
+    0x80,0x00,0x80,0x00,0x7E,0x00,0x00,0x00,0x3E,0x00,0x40,0x00,0x80,0x00,0x40,0x00,
+    0x3E,0x00,0x00,0x00,0xFE,0x00,0x40,0x00,0x30,0x00,0x40,0x00,0xFE,0x00,0x00,0x00,
+    0xC6,0x00,0x28,0x00,0x10,0x00,0x28,0x00,0xC6,0x00,0x00,0x00,0x0E,0x00,0x10,0x00,
+    0xE0,0x00,0x10,0x00,0x0E,0x00,0x00,0x00,0xC2,0x00,0xA2,0x00,0x92,0x00,0x8A,0x00,
+    0x86,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x82,0x00,0x82,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x82,0x00,
+    0x82,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x04,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x06,0x00,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xA8,0x00,
+    0xA8,0x00,0xA8,0x00,0xF0,0x00,0x00,0x00,0xFE,0x00,0x90,0x00,0x88,0x00,0x88,0x00,
+    0x70,0x00,0x00,0x00,0x70,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x40,0x00,0x00,0x00,
+    0x70,0x00,0x88,0x00,0x88,0x00,0x90,0x00,0xFE,0x00,0x00,0x00,0x70,0x00,0xA8,0x00,
+    0xA8,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x10,0x00,0xFC,0x00,0x12,0x00,0x02,0x00,
+    0x04,0x00,0x00,0x00,0x10,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x78,0x00,0x00,0x00,
+    0xFE,0x00,0x10,0x00,0x08,0x00,0x08,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x88,0x00,
+    0xFA,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x80,0x00,0x88,0x00,0x7A,0x00,
+    0x00,0x00,0x00,0x00,0xFE,0x00,0x20,0x00,0x50,0x00,0x88,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x82,0x00,0xFE,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x08,0x00,
+    0x30,0x00,0x08,0x00,0xF0,0x00,0x00,0x00,0xF8,0x00,0x10,0x00,0x08,0x00,0x08,0x00,
+    0xF0,0x00,0x00,0x00,0x70,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x70,0x00,0x00,0x00,
+    0xF8,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x28,0x00,
+    0x28,0x00,0x28,0x00,0xF8,0x00,0x00,0x00,0xF8,0x00,0x10,0x00,0x08,0x00,0x08,0x00,
+    0x10,0x00,0x00,0x00,0x90,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x40,0x00,0x00,0x00,
+    0x08,0x00,0x7E,0x00,0x88,0x00,0x80,0x00,0x40,0x00,0x00,0x00,0x78,0x00,0x80,0x00,
+    0x80,0x00,0x40,0x00,0xF8,0x00,0x00,0x00,0x38,0x00,0x40,0x00,0x80,0x00,0x40,0x00,
+    0x38,0x00,0x00,0x00,0x78,0x00,0x80,0x00,0x60,0x00,0x80,0x00,0x78,0x00,0x00,0x00,
+    0x88,0x00,0x50,0x00,0x20,0x00,0x50,0x00,0x88,0x00,0x00,0x00,0x18,0x00,0xA0,0x00,
+    0xA0,0x00,0xA0,0x00,0x78,0x00,0x00,0x00,0x88,0x00,0xC8,0x00,0xA8,0x00,0x98,0x00,
+    0x88,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x6C,0x00,0x82,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,
+    0x6C,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x10,0x00,0x10,0x00,0x20,0x00,
+    0x10,0x00,0x00,0x00,
+};
+
+static const uint8_t SHIFT2[1140] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7C,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,
+    0x00,0x00,0x00,0x00,0x50,0x00,0xFC,0x01,0x50,0x00,0xFC,0x01,0x50,0x00,0x00,0x00,
+    0x90,0x00,0xA8,0x00,0xFC,0x01,0xA8,0x00,0x48,0x00,0x00,0x00,0x8C,0x00,0x4C,0x00,
+    0x20,0x00,0x90,0x01,0x88,0x01,0x00,0x00,0xD8,0x00,0x24,0x01,0x54,0x01,0x88,0x00,
+    0x40,0x01,0x00,0x00,0x00,0x00,0x14,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x70,0x00,0x88,0x00,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x01,
+    0x88,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x20,0x00,0xF8,0x00,0x20,0x00,
+    0x50,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0xF8,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x40,0x01,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
+    0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0x80,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x00,0x00,
+    0xF8,0x00,0x44,0x01,0x24,0x01,0x14,0x01,0xF8,0x00,0x00,0x00,0x00,0x00,0x08,0x01,
+    0xFC,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x08,0x01,0x84,0x01,0x44,0x01,0x24,0x01,
+    0x18,0x01,0x00,0x00,0x84,0x00,0x04,0x01,0x14,0x01,0x2C,0x01,0xC4,0x00,0x00,0x00,
+    0x60,0x00,0x50,0x00,0x48,0x00,0xFC,0x01,0x40,0x00,0x00,0x00,0x9C,0x00,0x14,0x01,
+    0x14,0x01,0x14,0x01,0xE4,0x00,0x00,0x00,0xF0,0x00,0x28,0x01,0x24,0x01,0x24,0x01,
+    0xC0,0x00,0x00,0x00,0x04,0x00,0xC4,0x01,0x24,0x00,0x14,0x00,0x0C,0x00,0x00,0x00,
+    0xD8,0x00,0x24,0x01,0x24,0x01,0x24,0x01,0xD8,0x00,0x00,0x00,0x18,0x00,0x24,0x01,
+    0x24,0x01,0xA4,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xD8,0x00,0xD8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x01,0xD8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x50,0x00,0x88,0x00,0x04,0x01,0x00,0x00,0x00,0x00,0x50,0x00,0x50,0x00,
+    0x50,0x00,0x50,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x04,0x01,0x88,0x00,0x50,0x00,
+    0x20,0x00,0x00,0x00,0x08,0x00,0x04,0x00,0x44,0x01,0x24,0x00,0x18,0x00,0x00,0x00,
+    0xC8,0x00,0x24,0x01,0xE4,0x01,0x04,0x01,0xF8,0x00,0x00,0x00,0xF8,0x01,0x44,0x00,
+    0x44,0x00,0x44,0x00,0xF8,0x01,0x00,0x00,0xFC,0x01,0x24,0x01,0x24,0x01,0x24,0x01,
+    0xD8,0x00,0x00,0x00,0xF8,0x00,0x04,0x01,0x04,0x01,0x04,0x01,0x88,0x00,0x00,0x00,
+    0xFC,0x01,0x04,0x01,0x04,0x01,0x88,0x00,0x70,0x00,0x00,0x00,0xFC,0x01,0x24,0x01,
+    0x24,0x01,0x24,0x01,0x04,0x01,0x00,0x00,0xFC,0x01,0x24,0x00,0x24,0x00,0x24,0x00,
+    0x04,0x00,0x00,0x00,0xF8,0x00,0x04,0x01,0x24,0x01,0x24,0x01,0xE8,0x01,0x00,0x00,
+    0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0x04,0x01,
+    0xFC,0x01,0x04,0x01,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x01,0x04,0x01,0xFC,0x00,
+    0x04,0x00,0x00,0x00,0xFC,0x01,0x20,0x00,0x50,0x00,0x88,0x00,0x04,0x01,0x00,0x00,
+    0xFC,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0xFC,0x01,0x08,0x00,
+    0x30,0x00,0x08,0x00,0xFC,0x01,0x00,0x00,0xFC,0x01,0x10,0x00,0x20,0x00,0x40,0x00,
+    0xFC,0x01,0x00,0x00,0xF8,0x00,0x04,0x01,0x04,0x01,0x04,0x01,0xF8,0x00,0x00,0x00,
+    0xFC,0x01,0x24,0x00,0x24,0x00,0x24,0x00,0x18,0x00,0x00,0x00,0xF8,0x00,0x04,0x01,
+    0x44,0x01,0x84,0x00,0x78,0x01,0x00,0x00,0xFC,0x01,0x24,0x00,0x64,0x00,0xA4,0x00,
+    0x18,0x01,0x00,0x00,0x18,0x01,0x24,0x01,0x24,0x01,0x24,0x01,0xC4,0x00,0x00,0x00,
+    0x04,0x00,0x04,0x00,0xFC,0x01,0x04,0x00,0x04,0x00,0x00,0x00,0xFC,0x00,0x00,0x01,
+    0x00,0x01,0x00,0x01,0xFC,0x00,0x00,0x00,0x7C,0x00,0x80,0x00,0x00,0x01,0x80,0x00,
+    0x7C,0x00,0x00,0x00,0xFC,0x01,0x80,0x00,0x60,0x00,0x80,0x00,0xFC,0x01,0x00,0x00,
+    0x8C,0x01,0x50,0x00,0x20,0x00,0x50,0x00,0x8C,0x01,0x00,0x00,0x1C,0x00,0x20,0x00,
+    0xC0,0x01,0x20,0x00,0x1C,0x00,0x00,0x00,0x84,0x01,0x44,0x01,0x24,0x01,0x14,0x01,
+    0x0C,0x01,0x00,0x00,0x00,0x00,0xFC,0x01,0x04,0x01,0x04,0x01,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x04,0x01,
+    0x04,0x01,0xFC,0x01,0x00,0x00,0x00,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x08,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0C,0x00,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x50,0x01,
+    0x50,0x01,0x50,0x01,0xE0,0x01,0x00,0x00,0xFC,0x01,0x20,0x01,0x10,0x01,0x10,0x01,
+    0xE0,0x00,0x00,0x00,0xE0,0x00,0x10,0x01,0x10,0x01,0x10,0x01,0x80,0x00,0x00,0x00,
+    0xE0,0x00,0x10,0x01,0x10,0x01,0x20,0x01,0xFC,0x01,0x00,0x00,0xE0,0x00,0x50,0x01,
+    0x50,0x01,0x50,0x01,0x60,0x00,0x00,0x00,0x20,0x00,0xF8,0x01,0x24,0x00,0x04,0x00,
+    0x08,0x00,0x00,0x00,0x20,0x00,0x50,0x01,0x50,0x01,0x50,0x01,0xF0,0x00,0x00,0x00,
+    0xFC,0x01,0x20,0x00,0x10,0x00,0x10,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x10,0x01,
+    0xF4,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x01,0x10,0x01,0xF4,0x00,
+    0x00,0x00,0x00,0x00,0xFC,0x01,0x40,0x00,0xA0,0x00,0x10,0x01,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x04,0x01,0xFC,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0xF0,0x01,0x10,0x00,
+    0x60,0x00,0x10,0x00,0xE0,0x01,0x00,0x00,0xF0,0x01,0x20,0x00,0x10,0x00,0x10,0x00,
+    0xE0,0x01,0x00,0x00,0xE0,0x00,0x10,0x01,0x10,0x01,0x10,0x01,0xE0,0x00,0x00,0x00,
+    0xF0,0x01,0x50,0x00,0x50,0x00,0x50,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x50,0x00,
+    0x50,0x00,0x50,0x00,0xF0,0x01,0x00,0x00,0xF0,0x01,0x20,0x00,0x10,0x00,0x10,0x00,
+    0x20,0x00,0x00,0x00,0x20,0x01,0x50,0x01,0x50,0x01,0x50,0x01,0x80,0x00,0x00,0x00,
+    0x10,0x00,0xFC,0x00,0x10,0x01,0x00,0x01,0x80,0x00,0x00,0x00,0xF0,0x00,0x00,0x01,
+    0x00,0x01,0x80,0x00,0xF0,0x01,0x00,0x00,0x70,0x00,0x80,0x00,0x00,0x01,0x80,0x00,
+    0x70,0x00,0x00,0x00,0xF0,0x00,0x00,0x01,0xC0,0x00,0x00,0x01,0xF0,0x00,0x00,0x00,
+    0x10,0x01,0xA0,0x00,0x40,0x00,0xA0,0x00,0x10,0x01,0x00,0x00,0x30,0x00,0x40,0x01,
+    0x40,0x01,0x40,0x01,0xF0,0x00,0x00,0x00,0x10,0x01,0x90,0x01,0x50,0x01,0x30,0x01,
+    0x10,0x01,0x00,0x00,0x00,0x00,0x20,0x00,0xD8,0x00,0x04,0x01,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x01,
+    0xD8,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x40,0x00,
+    0x20,0x00,0x00,0x00,
+};
+
+static const uint8_t SHIFT3[1140] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xF8,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,
+    0x00,0x00,0x00,0x00,0xA0,0x00,0xF8,0x03,0xA0,0x00,0xF8,0x03,0xA0,0x00,0x00,0x00,
+    0x20,0x01,0x50,0x01,0xF8,0x03,0x50,0x01,0x90,0x00,0x00,0x00,0x18,0x01,0x98,0x00,
+    0x40,0x00,0x20,0x03,0x10,0x03,0x00,0x00,0xB0,0x01,0x48,0x02,0xA8,0x02,0x10,0x01,
+    0x80,0x02,0x00,0x00,0x00,0x00,0x28,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xE0,0x00,0x10,0x01,0x08,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x02,
+    0x10,0x01,0xE0,0x00,0x00,0x00,0x00,0x00,0xA0,0x00,0x40,0x00,0xF0,0x01,0x40,0x00,
+    0xA0,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0xF0,0x01,0x40,0x00,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x80,0x02,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,
+    0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x00,0x00,
+    0xF0,0x01,0x88,0x02,0x48,0x02,0x28,0x02,0xF0,0x01,0x00,0x00,0x00,0x00,0x10,0x02,
+    0xF8,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x10,0x02,0x08,0x03,0x88,0x02,0x48,0x02,
+    0x30,0x02,0x00,0x00,0x08,0x01,0x08,0x02,0x28,0x02,0x58,0x02,0x88,0x01,0x00,0x00,
+    0xC0,0x00,0xA0,0x00,0x90,0x00,0xF8,0x03,0x80,0x00,0x00,0x00,0x38,0x01,0x28,0x02,
+    0x28,0x02,0x28,0x02,0xC8,0x01,0x00,0x00,0xE0,0x01,0x50,0x02,0x48,0x02,0x48,0x02,
+    0x80,0x01,0x00,0x00,0x08,0x00,0x88,0x03,0x48,0x00,0x28,0x00,0x18,0x00,0x00,0x00,
+    0xB0,0x01,0x48,0x02,0x48,0x02,0x48,0x02,0xB0,0x01,0x00,0x00,0x30,0x00,0x48,0x02,
+    0x48,0x02,0x48,0x01,0xF0,0x00,0x00,0x00,0x00,0x00,0xB0,0x01,0xB0,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0x02,0xB0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x40,0x00,0xA0,0x00,0x10,0x01,0x08,0x02,0x00,0x00,0x00,0x00,0xA0,0x00,0xA0,0x00,
+    0xA0,0x00,0xA0,0x00,0xA0,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x10,0x01,0xA0,0x00,
+    0x40,0x00,0x00,0x00,0x10,0x00,0x08,0x00,0x88,0x02,0x48,0x00,0x30,0x00,0x00,0x00,
+    0x90,0x01,0x48,0x02,0xC8,0x03,0x08,0x02,0xF0,0x01,0x00,0x00,0xF0,0x03,0x88,0x00,
+    0x88,0x00,0x88,0x00,0xF0,0x03,0x00,0x00,0xF8,0x03,0x48,0x02,0x48,0x02,0x48,0x02,
+    0xB0,0x01,0x00,0x00,0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x01,0x00,0x00,
+    0xF8,0x03,0x08,0x02,0x08,0x02,0x10,0x01,0xE0,0x00,0x00,0x00,0xF8,0x03,0x48,0x02,
+    0x48,0x02,0x48,0x02,0x08,0x02,0x00,0x00,0xF8,0x03,0x48,0x00,0x48,0x00,0x48,0x00,
+    0x08,0x00,0x00,0x00,0xF0,0x01,0x08,0x02,0x48,0x02,0x48,0x02,0xD0,0x03,0x00,0x00,
+    0xF8,0x03,0x40,0x00,0x40,0x00,0x40,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0x08,0x02,
+    0xF8,0x03,0x08,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x08,0x02,0xF8,0x01,
+    0x08,0x00,0x00,0x00,0xF8,0x03,0x40,0x00,0xA0,0x00,0x10,0x01,0x08,0x02,0x00,0x00,
+    0xF8,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,0xF8,0x03,0x10,0x00,
+    0x60,0x00,0x10,0x00,0xF8,0x03,0x00,0x00,0xF8,0x03,0x20,0x00,0x40,0x00,0x80,0x00,
+    0xF8,0x03,0x00,0x00,0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,0x00,0x00,
+    0xF8,0x03,0x48,0x00,0x48,0x00,0x48,0x00,0x30,0x00,0x00,0x00,0xF0,0x01,0x08,0x02,
+    0x88,0x02,0x08,0x01,0xF0,0x02,0x00,0x00,0xF8,0x03,0x48,0x00,0xC8,0x00,0x48,0x01,
+    0x30,0x02,0x00,0x00,0x30,0x02,0x48,0x02,0x48,0x02,0x48,0x02,0x88,0x01,0x00,0x00,
+    0x08,0x00,0x08,0x00,0xF8,0x03,0x08,0x00,0x08,0x00,0x00,0x00,0xF8,0x01,0x00,0x02,
+    0x00,0x02,0x00,0x02,0xF8,0x01,0x00,0x00,0xF8,0x00,0x00,0x01,0x00,0x02,0x00,0x01,
+    0xF8,0x00,0x00,0x00,0xF8,0x03,0x00,0x01,0xC0,0x00,0x00,0x01,0xF8,0x03,0x00,0x00,
+    0x18,0x03,0xA0,0x00,0x40,0x00,0xA0,0x00,0x18,0x03,0x00,0x00,0x38,0x00,0x40,0x00,
+    0x80,0x03,0x40,0x00,0x38,0x00,0x00,0x00,0x08,0x03,0x88,0x02,0x48,0x02,0x28,0x02,
+    0x18,0x02,0x00,0x00,0x00,0x00,0xF8,0x03,0x08,0x02,0x08,0x02,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x08,0x02,
+    0x08,0x02,0xF8,0x03,0x00,0x00,0x00,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x10,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x18,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xA0,0x02,
+    0xA0,0x02,0xA0,0x02,0xC0,0x03,0x00,0x00,0xF8,0x03,0x40,0x02,0x20,0x02,0x20,0x02,
+    0xC0,0x01,0x00,0x00,0xC0,0x01,0x20,0x02,0x20,0x02,0x20,0x02,0x00,0x01,0x00,0x00,
+    0xC0,0x01,0x20,0x02,0x20,0x02,0x40,0x02,0xF8,0x03,0x00,0x00,0xC0,0x01,0xA0,0x02,
+    0xA0,0x02,0xA0,0x02,0xC0,0x00,0x00,0x00,0x40,0x00,0xF0,0x03,0x48,0x00,0x08,0x00,
+    0x10,0x00,0x00,0x00,0x40,0x00,0xA0,0x02,0xA0,0x02,0xA0,0x02,0xE0,0x01,0x00,0x00,
+    0xF8,0x03,0x40,0x00,0x20,0x00,0x20,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0x20,0x02,
+    0xE8,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x20,0x02,0xE8,0x01,
+    0x00,0x00,0x00,0x00,0xF8,0x03,0x80,0x00,0x40,0x01,0x20,0x02,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x08,0x02,0xF8,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0xE0,0x03,0x20,0x00,
+    0xC0,0x00,0x20,0x00,0xC0,0x03,0x00,0x00,0xE0,0x03,0x40,0x00,0x20,0x00,0x20,0x00,
+    0xC0,0x03,0x00,0x00,0xC0,0x01,0x20,0x02,0x20,0x02,0x20,0x02,0xC0,0x01,0x00,0x00,
+    0xE0,0x03,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x40,0x00,0x00,0x00,0x40,0x00,0xA0,0x00,
+    0xA0,0x00,0xA0,0x00,0xE0,0x03,0x00,0x00,0xE0,0x03,0x40,0x00,0x20,0x00,0x20,0x00,
+    0x40,0x00,0x00,0x00,0x40,0x02,0xA0,0x02,0xA0,0x02,0xA0,0x02,0x00,0x01,0x00,0x00,
+    0x20,0x00,0xF8,0x01,0x20,0x02,0x00,0x02,0x00,0x01,0x00,0x00,0xE0,0x01,0x00,0x02,
+    0x00,0x02,0x00,0x01,0xE0,0x03,0x00,0x00,0xE0,0x00,0x00,0x01,0x00,0x02,0x00,0x01,
+    0xE0,0x00,0x00,0x00,0xE0,0x01,0x00,0x02,0x80,0x01,0x00,0x02,0xE0,0x01,0x00,0x00,
+    0x20,0x02,0x40,0x01,0x80,0x00,0x40,0x01,0x20,0x02,0x00,0x00,0x60,0x00,0x80,0x02,
+    0x80,0x02,0x80,0x02,0xE0,0x01,0x00,0x00,0x20,0x02,0x20,0x03,0xA0,0x02,0x60,0x02,
+    0x20,0x02,0x00,0x00,0x00,0x00,0x40,0x00,0xB0,0x01,0x08,0x02,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x02,
+    0xB0,0x01,0x40,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x40,0x00,0x40,0x00,0x80,0x00,
+    0x40,0x00,0x00,0x00,
+};
+
+static const uint8_t SHIFT4[1140] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xF0,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,
+    0x00,0x00,0x00,0x00,0x40,0x01,0xF0,0x07,0x40,0x01,0xF0,0x07,0x40,0x01,0x00,0x00,
+    0x40,0x02,0xA0,0x02,0xF0,0x07,0xA0,0x02,0x20,0x01,0x00,0x00,0x30,0x02,0x30,0x01,
+    0x80,0x00,0x40,0x06,0x20,0x06,0x00,0x00,0x60,0x03,0x90,0x04,0x50,0x05,0x20,0x02,
+    0x00,0x05,0x00,0x00,0x00,0x00,0x50,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xC0,0x01,0x20,0x02,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x04,
+    0x20,0x02,0xC0,0x01,0x00,0x00,0x00,0x00,0x40,0x01,0x80,0x00,0xE0,0x03,0x80,0x00,
+    0x40,0x01,0x00,0x00,0x80,0x00,0x80,0x00,0xE0,0x03,0x80,0x00,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x80,0x00,
+    0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x80,0x00,0x40,0x00,0x20,0x00,0x00,0x00,
+    0xE0,0x03,0x10,0x05,0x90,0x04,0x50,0x04,0xE0,0x03,0x00,0x00,0x00,0x00,0x20,0x04,
+    0xF0,0x07,0x00,0x04,0x00,0x00,0x00,0x00,0x20,0x04,0x10,0x06,0x10,0x05,0x90,0x04,
+    0x60,0x04,0x00,0x00,0x10,0x02,0x10,0x04,0x50,0x04,0xB0,0x04,0x10,0x03,0x00,0x00,
+    0x80,0x01,0x40,0x01,0x20,0x01,0xF0,0x07,0x00,0x01,0x00,0x00,0x70,0x02,0x50,0x04,
+    0x50,0x04,0x50,0x04,0x90,0x03,0x00,0x00,0xC0,0x03,0xA0,0x04,0x90,0x04,0x90,0x04,
+    0x00,0x03,0x00,0x00,0x10,0x00,0x10,0x07,0x90,0x00,0x50,0x00,0x30,0x00,0x00,0x00,
+    0x60,0x03,0x90,0x04,0x90,0x04,0x90,0x04,0x60,0x03,0x00,0x00,0x60,0x00,0x90,0x04,
+    0x90,0x04,0x90,0x02,0xE0,0x01,0x00,0x00,0x00,0x00,0x60,0x03,0x60,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x05,0x60,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x00,0x40,0x01,0x20,0x02,0x10,0x04,0x00,0x00,0x00,0x00,0x40,0x01,0x40,0x01,
+    0x40,0x01,0x40,0x01,0x40,0x01,0x00,0x00,0x00,0x00,0x10,0x04,0x20,0x02,0x40,0x01,
+    0x80,0x00,0x00,0x00,0x20,0x00,0x10,0x00,0x10,0x05,0x90,0x00,0x60,0x00,0x00,0x00,
+    0x20,0x03,0x90,0x04,0x90,0x07,0x10,0x04,0xE0,0x03,0x00,0x00,0xE0,0x07,0x10,0x01,
+    0x10,0x01,0x10,0x01,0xE0,0x07,0x00,0x00,0xF0,0x07,0x90,0x04,0x90,0x04,0x90,0x04,
+    0x60,0x03,0x00,0x00,0xE0,0x03,0x10,0x04,0x10,0x04,0x10,0x04,0x20,0x02,0x00,0x00,
+    0xF0,0x07,0x10,0x04,0x10,0x04,0x20,0x02,0xC0,0x01,0x00,0x00,0xF0,0x07,0x90,0x04,
+    0x90,0x04,0x90,0x04,0x10,0x04,0x00,0x00,0xF0,0x07,0x90,0x00,0x90,0x00,0x90,0x00,
+    0x10,0x00,0x00,0x00,0xE0,0x03,0x10,0x04,0x90,0x04,0x90,0x04,0xA0,0x07,0x00,0x00,
+    0xF0,0x07,0x80,0x00,0x80,0x00,0x80,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0x10,0x04,
+    0xF0,0x07,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x10,0x04,0xF0,0x03,
+    0x10,0x00,0x00,0x00,0xF0,0x07,0x80,0x00,0x40,0x01,0x20,0x02,0x10,0x04,0x00,0x00,
+    0xF0,0x07,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x00,0xF0,0x07,0x20,0x00,
+    0xC0,0x00,0x20,0x00,0xF0,0x07,0x00,0x00,0xF0,0x07,0x40,0x00,0x80,0x00,0x00,0x01,
+    0xF0,0x07,0x00,0x00,0xE0,0x03,0x10,0x04,0x10,0x04,0x10,0x04,0xE0,0x03,0x00,0x00,
+    0xF0,0x07,0x90,0x00,0x90,0x00,0x90,0x00,0x60,0x00,0x00,0x00,0xE0,0x03,0x10,0x04,
+    0x10,0x05,0x10,0x02,0xE0,0x05,0x00,0x00,0xF0,0x07,0x90,0x00,0x90,0x01,0x90,0x02,
+    0x60,0x04,0x00,0x00,0x60,0x04,0x90,0x04,0x90,0x04,0x90,0x04,0x10,0x03,0x00,0x00,
+    0x10,0x00,0x10,0x00,0xF0,0x07,0x10,0x00,0x10,0x00,0x00,0x00,0xF0,0x03,0x00,0x04,
+    0x00,0x04,0x00,0x04,0xF0,0x03,0x00,0x00,0xF0,0x01,0x00,0x02,0x00,0x04,0x00,0x02,
+    0xF0,0x01,0x00,0x00,0xF0,0x07,0x00,0x02,0x80,0x01,0x00,0x02,0xF0,0x07,0x00,0x00,
+    0x30,0x06,0x40,0x01,0x80,0x00,0x40,0x01,0x30,0x06,0x00,0x00,0x70,0x00,0x80,0x00,
+    0x00,0x07,0x80,0x00,0x70,0x00,0x00,0x00,0x10,0x06,0x10,0x05,0x90,0x04,0x50,0x04,
+    0x30,0x04,0x00,0x00,0x00,0x00,0xF0,0x07,0x10,0x04,0x10,0x04,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x10,0x04,
+    0x10,0x04,0xF0,0x07,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x20,0x00,
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x30,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x40,0x05,
+    0x40,0x05,0x40,0x05,0x80,0x07,0x00,0x00,0xF0,0x07,0x80,0x04,0x40,0x04,0x40,0x04,
+    0x80,0x03,0x00,0x00,0x80,0x03,0x40,0x04,0x40,0x04,0x40,0x04,0x00,0x02,0x00,0x00,
+    0x80,0x03,0x40,0x04,0x40,0x04,0x80,0x04,0xF0,0x07,0x00,0x00,0x80,0x03,0x40,0x05,
+    0x40,0x05,0x40,0x05,0x80,0x01,0x00,0x00,0x80,0x00,0xE0,0x07,0x90,0x00,0x10,0x00,
+    0x20,0x00,0x00,0x00,0x80,0x00,0x40,0x05,0x40,0x05,0x40,0x05,0xC0,0x03,0x00,0x00,
+    0xF0,0x07,0x80,0x00,0x40,0x00,0x40,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x40,0x04,
+    0xD0,0x07,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x40,0x04,0xD0,0x03,
+    0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x01,0x80,0x02,0x40,0x04,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x10,0x04,0xF0,0x07,0x00,0x04,0x00,0x00,0x00,0x00,0xC0,0x07,0x40,0x00,
+    0x80,0x01,0x40,0x00,0x80,0x07,0x00,0x00,0xC0,0x07,0x80,0x00,0x40,0x00,0x40,0x00,
+    0x80,0x07,0x00,0x00,0x80,0x03,0x40,0x04,0x40,0x04,0x40,0x04,0x80,0x03,0x00,0x00,
+    0xC0,0x07,0x40,0x01,0x40,0x01,0x40,0x01,0x80,0x00,0x00,0x00,0x80,0x00,0x40,0x01,
+    0x40,0x01,0x40,0x01,0xC0,0x07,0x00,0x00,0xC0,0x07,0x80,0x00,0x40,0x00,0x40,0x00,
+    0x80,0x00,0x00,0x00,0x80,0x04,0x40,0x05,0x40,0x05,0x40,0x05,0x00,0x02,0x00,0x00,
+    0x40,0x00,0xF0,0x03,0x40,0x04,0x00,0x04,0x00,0x02,0x00,0x00,0xC0,0x03,0x00,0x04,
+    0x00,0x04,0x00,0x02,0xC0,0x07,0x00,0x00,0xC0,0x01,0x00,0x02,0x00,0x04,0x00,0x02,
+    0xC0,0x01,0x00,0x00,0xC0,0x03,0x00,0x04,0x00,0x03,0x00,0x04,0xC0,0x03,0x00,0x00,
+    0x40,0x04,0x80,0x02,0x00,0x01,0x80,0x02,0x40,0x04,0x00,0x00,0xC0,0x00,0x00,0x05,
+    0x00,0x05,0x00,0x05,0xC0,0x03,0x00,0x00,0x40,0x04,0x40,0x06,0x40,0x05,0xC0,0x04,
+    0x40,0x04,0x00,0x00,0x00,0x00,0x80,0x00,0x60,0x03,0x10,0x04,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x04,
+    0x60,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x00,0x80,0x00,0x00,0x01,
+    0x80,0x00,0x00,0x00,
+};
+
+static const uint8_t SHIFT5[1140] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xE0,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,
+    0x00,0x00,0x00,0x00,0x80,0x02,0xE0,0x0F,0x80,0x02,0xE0,0x0F,0x80,0x02,0x00,0x00,
+    0x80,0x04,0x40,0x05,0xE0,0x0F,0x40,0x05,0x40,0x02,0x00,0x00,0x60,0x04,0x60,0x02,
+    0x00,0x01,0x80,0x0C,0x40,0x0C,0x00,0x00,0xC0,0x06,0x20,0x09,0xA0,0x0A,0x40,0x04,
+    0x00,0x0A,0x00,0x00,0x00,0x00,0xA0,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x80,0x03,0x40,0x04,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
+    0x40,0x04,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x02,0x00,0x01,0xC0,0x07,0x00,0x01,
+    0x80,0x02,0x00,0x00,0x00,0x01,0x00,0x01,0xC0,0x07,0x00,0x01,0x00,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x0A,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,
+    0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x00,0x01,0x80,0x00,0x40,0x00,0x00,0x00,
+    0xC0,0x07,0x20,0x0A,0x20,0x09,0xA0,0x08,0xC0,0x07,0x00,0x00,0x00,0x00,0x40,0x08,
+    0xE0,0x0F,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x08,0x20,0x0C,0x20,0x0A,0x20,0x09,
+    0xC0,0x08,0x00,0x00,0x20,0x04,0x20,0x08,0xA0,0x08,0x60,0x09,0x20,0x06,0x00,0x00,
+    0x00,0x03,0x80,0x02,0x40,0x02,0xE0,0x0F,0x00,0x02,0x00,0x00,0xE0,0x04,0xA0,0x08,
+    0xA0,0x08,0xA0,0x08,0x20,0x07,0x00,0x00,0x80,0x07,0x40,0x09,0x20,0x09,0x20,0x09,
+    0x00,0x06,0x00,0x00,0x20,0x00,0x20,0x0E,0x20,0x01,0xA0,0x00,0x60,0x00,0x00,0x00,
+    0xC0,0x06,0x20,0x09,0x20,0x09,0x20,0x09,0xC0,0x06,0x00,0x00,0xC0,0x00,0x20,0x09,
+    0x20,0x09,0x20,0x05,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x06,0xC0,0x06,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x0A,0xC0,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x00,0x00,0x00,0x00,0x80,0x02,0x80,0x02,
+    0x80,0x02,0x80,0x02,0x80,0x02,0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x04,0x80,0x02,
+    0x00,0x01,0x00,0x00,0x40,0x00,0x20,0x00,0x20,0x0A,0x20,0x01,0xC0,0x00,0x00,0x00,
+    0x40,0x06,0x20,0x09,0x20,0x0F,0x20,0x08,0xC0,0x07,0x00,0x00,0xC0,0x0F,0x20,0x02,
+    0x20,0x02,0x20,0x02,0xC0,0x0F,0x00,0x00,0xE0,0x0F,0x20,0x09,0x20,0x09,0x20,0x09,
+    0xC0,0x06,0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0x40,0x04,0x00,0x00,
+    0xE0,0x0F,0x20,0x08,0x20,0x08,0x40,0x04,0x80,0x03,0x00,0x00,0xE0,0x0F,0x20,0x09,
+    0x20,0x09,0x20,0x09,0x20,0x08,0x00,0x00,0xE0,0x0F,0x20,0x01,0x20,0x01,0x20,0x01,
+    0x20,0x00,0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x09,0x20,0x09,0x40,0x0F,0x00,0x00,
+    0xE0,0x0F,0x00,0x01,0x00,0x01,0x00,0x01,0xE0,0x0F,0x00,0x00,0x00,0x00,0x20,0x08,
+    0xE0,0x0F,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x08,0x20,0x08,0xE0,0x07,
+    0x20,0x00,0x00,0x00,0xE0,0x0F,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x00,0x00,
+    0xE0,0x0F,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x00,0xE0,0x0F,0x40,0x00,
+    0x80,0x01,0x40,0x00,0xE0,0x0F,0x00,0x00,0xE0,0x0F,0x80,0x00,0x00,0x01,0x00,0x02,
+    0xE0,0x0F,0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,0x00,0x00,
+    0xE0,0x0F,0x20,0x01,0x20,0x01,0x20,0x01,0xC0,0x00,0x00,0x00,0xC0,0x07,0x20,0x08,
+    0x20,0x0A,0x20,0x04,0xC0,0x0B,0x00,0x00,0xE0,0x0F,0x20,0x01,0x20,0x03,0x20,0x05,
+    0xC0,0x08,0x00,0x00,0xC0,0x08,0x20,0x09,0x20,0x09,0x20,0x09,0x20,0x06,0x00,0x00,
+    0x20,0x00,0x20,0x00,0xE0,0x0F,0x20,0x00,0x20,0x00,0x00,0x00,0xE0,0x07,0x00,0x08,
+    0x00,0x08,0x00,0x08,0xE0,0x07,0x00,0x00,0xE0,0x03,0x00,0x04,0x00,0x08,0x00,0x04,
+    0xE0,0x03,0x00,0x00,0xE0,0x0F,0x00,0x04,0x00,0x03,0x00,0x04,0xE0,0x0F,0x00,0x00,
+    0x60,0x0C,0x80,0x02,0x00,0x01,0x80,0x02,0x60,0x0C,0x00,0x00,0xE0,0x00,0x00,0x01,
+    0x00,0x0E,0x00,0x01,0xE0,0x00,0x00,0x00,0x20,0x0C,0x20,0x0A,0x20,0x09,0xA0,0x08,
+    0x60,0x08,0x00,0x00,0x00,0x00,0xE0,0x0F,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,
+    0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x00,0x20,0x08,
+    0x20,0x08,0xE0,0x0F,0x00,0x00,0x00,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x40,0x00,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x60,0x00,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x80,0x0A,
+    0x80,0x0A,0x80,0x0A,0x00,0x0F,0x00,0x00,0xE0,0x0F,0x00,0x09,0x80,0x08,0x80,0x08,
+    0x00,0x07,0x00,0x00,0x00,0x07,0x80,0x08,0x80,0x08,0x80,0x08,0x00,0x04,0x00,0x00,
+    0x00,0x07,0x80,0x08,0x80,0x08,0x00,0x09,0xE0,0x0F,0x00,0x00,0x00,0x07,0x80,0x0A,
+    0x80,0x0A,0x80,0x0A,0x00,0x03,0x00,0x00,0x00,0x01,0xC0,0x0F,0x20,0x01,0x20,0x00,
+    0x40,0x00,0x00,0x00,0x00,0x01,0x80,0x0A,0x80,0x0A,0x80,0x0A,0x80,0x07,0x00,0x00,
+    0xE0,0x0F,0x00,0x01,0x80,0x00,0x80,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x80,0x08,
+    0xA0,0x0F,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x08,0x80,0x08,0xA0,0x07,
+    0x00,0x00,0x00,0x00,0xE0,0x0F,0x00,0x02,0x00,0x05,0x80,0x08,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x20,0x08,0xE0,0x0F,0x00,0x08,0x00,0x00,0x00,0x00,0x80,0x0F,0x80,0x00,
+    0x00,0x03,0x80,0x00,0x00,0x0F,0x00,0x00,0x80,0x0F,0x00,0x01,0x80,0x00,0x80,0x00,
+    0x00,0x0F,0x00,0x00,0x00,0x07,0x80,0x08,0x80,0x08,0x80,0x08,0x00,0x07,0x00,0x00,
+    0x80,0x0F,0x80,0x02,0x80,0x02,0x80,0x02,0x00,0x01,0x00,0x00,0x00,0x01,0x80,0x02,
+    0x80,0x02,0x80,0x02,0x80,0x0F,0x00,0x00,0x80,0x0F,0x00,0x01,0x80,0x00,0x80,0x00,
+    0x00,0x01,0x00,0x00,0x00,0x09,0x80,0x0A,0x80,0x0A,0x80,0x0A,0x00,0x04,0x00,0x00,
+    0x80,0x00,0xE0,0x07,0x80,0x08,0x00,0x08,0x00,0x04,0x00,0x00,0x80,0x07,0x00,0x08,
+    0x00,0x08,0x00,0x04,0x80,0x0F,0x00,0x00,0x80,0x03,0x00,0x04,0x00,0x08,0x00,0x04,
+    0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x08,0x00,0x06,0x00,0x08,0x80,0x07,0x00,0x00,
+    0x80,0x08,0x00,0x05,0x00,0x02,0x00,0x05,0x80,0x08,0x00,0x00,0x80,0x01,0x00,0x0A,
+    0x00,0x0A,0x00,0x0A,0x80,0x07,0x00,0x00,0x80,0x08,0x80,0x0C,0x80,0x0A,0x80,0x09,
+    0x80,0x08,0x00,0x00,0x00,0x00,0x00,0x01,0xC0,0x06,0x20,0x08,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
+    0xC0,0x06,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x02,
+    0x00,0x01,0x00,0x00,
+};
+
+static const uint8_t SHIFT6[1140] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xC0,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0xC0,0x01,
+    0x00,0x00,0x00,0x00,0x00,0x05,0xC0,0x1F,0x00,0x05,0xC0,0x1F,0x00,0x05,0x00,0x00,
+    0x00,0x09,0x80,0x0A,0xC0,0x1F,0x80,0x0A,0x80,0x04,0x00,0x00,0xC0,0x08,0xC0,0x04,
+    0x00,0x02,0x00,0x19,0x80,0x18,0x00,0x00,0x80,0x0D,0x40,0x12,0x40,0x15,0x80,0x08,
+    0x00,0x14,0x00,0x00,0x00,0x00,0x40,0x01,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0x80,0x08,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,
+    0x80,0x08,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x02,0x80,0x0F,0x00,0x02,
+    0x00,0x05,0x00,0x00,0x00,0x02,0x00,0x02,0x80,0x0F,0x00,0x02,0x00,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x14,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,
+    0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x18,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,0x80,0x00,0x00,0x00,
+    0x80,0x0F,0x40,0x14,0x40,0x12,0x40,0x11,0x80,0x0F,0x00,0x00,0x00,0x00,0x80,0x10,
+    0xC0,0x1F,0x00,0x10,0x00,0x00,0x00,0x00,0x80,0x10,0x40,0x18,0x40,0x14,0x40,0x12,
+    0x80,0x11,0x00,0x00,0x40,0x08,0x40,0x10,0x40,0x11,0xC0,0x12,0x40,0x0C,0x00,0x00,
+    0x00,0x06,0x00,0x05,0x80,0x04,0xC0,0x1F,0x00,0x04,0x00,0x00,0xC0,0x09,0x40,0x11,
+    0x40,0x11,0x40,0x11,0x40,0x0E,0x00,0x00,0x00,0x0F,0x80,0x12,0x40,0x12,0x40,0x12,
+    0x00,0x0C,0x00,0x00,0x40,0x00,0x40,0x1C,0x40,0x02,0x40,0x01,0xC0,0x00,0x00,0x00,
+    0x80,0x0D,0x40,0x12,0x40,0x12,0x40,0x12,0x80,0x0D,0x00,0x00,0x80,0x01,0x40,0x12,
+    0x40,0x12,0x40,0x0A,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x0D,0x80,0x0D,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x15,0x80,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x02,0x00,0x05,0x80,0x08,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x05,
+    0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x00,0x00,0x00,0x40,0x10,0x80,0x08,0x00,0x05,
+    0x00,0x02,0x00,0x00,0x80,0x00,0x40,0x00,0x40,0x14,0x40,0x02,0x80,0x01,0x00,0x00,
+    0x80,0x0C,0x40,0x12,0x40,0x1E,0x40,0x10,0x80,0x0F,0x00,0x00,0x80,0x1F,0x40,0x04,
+    0x40,0x04,0x40,0x04,0x80,0x1F,0x00,0x00,0xC0,0x1F,0x40,0x12,0x40,0x12,0x40,0x12,
+    0x80,0x0D,0x00,0x00,0x80,0x0F,0x40,0x10,0x40,0x10,0x40,0x10,0x80,0x08,0x00,0x00,
+    0xC0,0x1F,0x40,0x10,0x40,0x10,0x80,0x08,0x00,0x07,0x00,0x00,0xC0,0x1F,0x40,0x12,
+    0x40,0x12,0x40,0x12,0x40,0x10,0x00,0x00,0xC0,0x1F,0x40,0x02,0x40,0x02,0x40,0x02,
+    0x40,0x00,0x00,0x00,0x80,0x0F,0x40,0x10,0x40,0x12,0x40,0x12,0x80,0x1E,0x00,0x00,
+    0xC0,0x1F,0x00,0x02,0x00,0x02,0x00,0x02,0xC0,0x1F,0x00,0x00,0x00,0x00,0x40,0x10,
+    0xC0,0x1F,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x10,0x40,0x10,0xC0,0x0F,
+    0x40,0x00,0x00,0x00,0xC0,0x1F,0x00,0x02,0x00,0x05,0x80,0x08,0x40,0x10,0x00,0x00,
+    0xC0,0x1F,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x00,0xC0,0x1F,0x80,0x00,
+    0x00,0x03,0x80,0x00,0xC0,0x1F,0x00,0x00,0xC0,0x1F,0x00,0x01,0x00,0x02,0x00,0x04,
+    0xC0,0x1F,0x00,0x00,0x80,0x0F,0x40,0x10,0x40,0x10,0x40,0x10,0x80,0x0F,0x00,0x00,
+    0xC0,0x1F,0x40,0x02,0x40,0x02,0x40,0x02,0x80,0x01,0x00,0x00,0x80,0x0F,0x40,0x10,
+    0x40,0x14,0x40,0x08,0x80,0x17,0x00,0x00,0xC0,0x1F,0x40,0x02,0x40,0x06,0x40,0x0A,
+    0x80,0x11,0x00,0x00,0x80,0x11,0x40,0x12,0x40,0x12,0x40,0x12,0x40,0x0C,0x00,0x00,
+    0x40,0x00,0x40,0x00,0xC0,0x1F,0x40,0x00,0x40,0x00,0x00,0x00,0xC0,0x0F,0x00,0x10,
+    0x00,0x10,0x00,0x10,0xC0,0x0F,0x00,0x00,0xC0,0x07,0x00,0x08,0x00,0x10,0x00,0x08,
+    0xC0,0x07,0x00,0x00,0xC0,0x1F,0x00,0x08,0x00,0x06,0x00,0x08,0xC0,0x1F,0x00,0x00,
+    0xC0,0x18,0x00,0x05,0x00,0x02,0x00,0x05,0xC0,0x18,0x00,0x00,0xC0,0x01,0x00,0x02,
+    0x00,0x1C,0x00,0x02,0xC0,0x01,0x00,0x00,0x40,0x18,0x40,0x14,0x40,0x12,0x40,0x11,
+    0xC0,0x10,0x00,0x00,0x00,0x00,0xC0,0x1F,0x40,0x10,0x40,0x10,0x00,0x00,0x00,0x00,
+    0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x10,
+    0x40,0x10,0xC0,0x1F,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x00,0x40,0x00,0x80,0x00,
+    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xC0,0x00,0x40,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x15,
+    0x00,0x15,0x00,0x15,0x00,0x1E,0x00,0x00,0xC0,0x1F,0x00,0x12,0x00,0x11,0x00,0x11,
+    0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x08,0x00,0x00,
+    0x00,0x0E,0x00,0x11,0x00,0x11,0x00,0x12,0xC0,0x1F,0x00,0x00,0x00,0x0E,0x00,0x15,
+    0x00,0x15,0x00,0x15,0x00,0x06,0x00,0x00,0x00,0x02,0x80,0x1F,0x40,0x02,0x40,0x00,
+    0x80,0x00,0x00,0x00,0x00,0x02,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x0F,0x00,0x00,
+    0xC0,0x1F,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x11,
+    0x40,0x1F,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x10,0x00,0x11,0x40,0x0F,
+    0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x04,0x00,0x0A,0x00,0x11,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x40,0x10,0xC0,0x1F,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x01,
+    0x00,0x06,0x00,0x01,0x00,0x1E,0x00,0x00,0x00,0x1F,0x00,0x02,0x00,0x01,0x00,0x01,
+    0x00,0x1E,0x00,0x00,0x00,0x0E,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x0E,0x00,0x00,
+    0x00,0x1F,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x05,
+    0x00,0x05,0x00,0x05,0x00,0x1F,0x00,0x00,0x00,0x1F,0x00,0x02,0x00,0x01,0x00,0x01,
+    0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x08,0x00,0x00,
+    0x00,0x01,0xC0,0x0F,0x00,0x11,0x00,0x10,0x00,0x08,0x00,0x00,0x00,0x0F,0x00,0x10,
+    0x00,0x10,0x00,0x08,0x00,0x1F,0x00,0x00,0x00,0x07,0x00,0x08,0x00,0x10,0x00,0x08,
+    0x00,0x07,0x00,0x00,0x00,0x0F,0x00,0x10,0x00,0x0C,0x00,0x10,0x00,0x0F,0x00,0x00,
+    0x00,0x11,0x00,0x0A,0x00,0x04,0x00,0x0A,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x14,
+    0x00,0x14,0x00,0x14,0x00,0x0F,0x00,0x00,0x00,0x11,0x00,0x19,0x00,0x15,0x00,0x13,
+    0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x02,0x80,0x0D,0x40,0x10,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,
+    0x80,0x0D,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x00,0x02,0x00,0x04,
+    0x00,0x02,0x00,0x00,
+};
+
+static const uint8_t SHIFT7[1140] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,
+    0x00,0x00,0x00,0x00,0x00,0x0A,0x80,0x3F,0x00,0x0A,0x80,0x3F,0x00,0x0A,0x00,0x00,
+    0x00,0x12,0x00,0x15,0x80,0x3F,0x00,0x15,0x00,0x09,0x00,0x00,0x80,0x11,0x80,0x09,
+    0x00,0x04,0x00,0x32,0x00,0x31,0x00,0x00,0x00,0x1B,0x80,0x24,0x80,0x2A,0x00,0x11,
+    0x00,0x28,0x00,0x00,0x00,0x00,0x80,0x02,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0E,0x00,0x11,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,
+    0x00,0x11,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,
+    0x00,0x0A,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x04,0x00,0x00,
+    0x00,0x00,0x00,0x28,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,
+    0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x30,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,0x00,0x00,
+    0x00,0x1F,0x80,0x28,0x80,0x24,0x80,0x22,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x21,
+    0x80,0x3F,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x80,0x30,0x80,0x28,0x80,0x24,
+    0x00,0x23,0x00,0x00,0x80,0x10,0x80,0x20,0x80,0x22,0x80,0x25,0x80,0x18,0x00,0x00,
+    0x00,0x0C,0x00,0x0A,0x00,0x09,0x80,0x3F,0x00,0x08,0x00,0x00,0x80,0x13,0x80,0x22,
+    0x80,0x22,0x80,0x22,0x80,0x1C,0x00,0x00,0x00,0x1E,0x00,0x25,0x80,0x24,0x80,0x24,
+    0x00,0x18,0x00,0x00,0x80,0x00,0x80,0x38,0x80,0x04,0x80,0x02,0x80,0x01,0x00,0x00,
+    0x00,0x1B,0x80,0x24,0x80,0x24,0x80,0x24,0x00,0x1B,0x00,0x00,0x00,0x03,0x80,0x24,
+    0x80,0x24,0x80,0x14,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x1B,0x00,0x1B,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B,0x00,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x04,0x00,0x0A,0x00,0x11,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x0A,
+    0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x00,0x00,0x00,0x80,0x20,0x00,0x11,0x00,0x0A,
+    0x00,0x04,0x00,0x00,0x00,0x01,0x80,0x00,0x80,0x28,0x80,0x04,0x00,0x03,0x00,0x00,
+    0x00,0x19,0x80,0x24,0x80,0x3C,0x80,0x20,0x00,0x1F,0x00,0x00,0x00,0x3F,0x80,0x08,
+    0x80,0x08,0x80,0x08,0x00,0x3F,0x00,0x00,0x80,0x3F,0x80,0x24,0x80,0x24,0x80,0x24,
+    0x00,0x1B,0x00,0x00,0x00,0x1F,0x80,0x20,0x80,0x20,0x80,0x20,0x00,0x11,0x00,0x00,
+    0x80,0x3F,0x80,0x20,0x80,0x20,0x00,0x11,0x00,0x0E,0x00,0x00,0x80,0x3F,0x80,0x24,
+    0x80,0x24,0x80,0x24,0x80,0x20,0x00,0x00,0x80,0x3F,0x80,0x04,0x80,0x04,0x80,0x04,
+    0x80,0x00,0x00,0x00,0x00,0x1F,0x80,0x20,0x80,0x24,0x80,0x24,0x00,0x3D,0x00,0x00,
+    0x80,0x3F,0x00,0x04,0x00,0x04,0x00,0x04,0x80,0x3F,0x00,0x00,0x00,0x00,0x80,0x20,
+    0x80,0x3F,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x20,0x80,0x20,0x80,0x1F,
+    0x80,0x00,0x00,0x00,0x80,0x3F,0x00,0x04,0x00,0x0A,0x00,0x11,0x80,0x20,0x00,0x00,
+    0x80,0x3F,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x80,0x3F,0x00,0x01,
+    0x00,0x06,0x00,0x01,0x80,0x3F,0x00,0x00,0x80,0x3F,0x00,0x02,0x00,0x04,0x00,0x08,
+    0x80,0x3F,0x00,0x00,0x00,0x1F,0x80,0x20,0x80,0x20,0x80,0x20,0x00,0x1F,0x00,0x00,
+    0x80,0x3F,0x80,0x04,0x80,0x04,0x80,0x04,0x00,0x03,0x00,0x00,0x00,0x1F,0x80,0x20,
+    0x80,0x28,0x80,0x10,0x00,0x2F,0x00,0x00,0x80,0x3F,0x80,0x04,0x80,0x0C,0x80,0x14,
+    0x00,0x23,0x00,0x00,0x00,0x23,0x80,0x24,0x80,0x24,0x80,0x24,0x80,0x18,0x00,0x00,
+    0x80,0x00,0x80,0x00,0x80,0x3F,0x80,0x00,0x80,0x00,0x00,0x00,0x80,0x1F,0x00,0x20,
+    0x00,0x20,0x00,0x20,0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,0x10,0x00,0x20,0x00,0x10,
+    0x80,0x0F,0x00,0x00,0x80,0x3F,0x00,0x10,0x00,0x0C,0x00,0x10,0x80,0x3F,0x00,0x00,
+    0x80,0x31,0x00,0x0A,0x00,0x04,0x00,0x0A,0x80,0x31,0x00,0x00,0x80,0x03,0x00,0x04,
+    0x00,0x38,0x00,0x04,0x80,0x03,0x00,0x00,0x80,0x30,0x80,0x28,0x80,0x24,0x80,0x22,
+    0x80,0x21,0x00,0x00,0x00,0x00,0x80,0x3F,0x80,0x20,0x80,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x00,0x00,0x00,0x80,0x20,
+    0x80,0x20,0x80,0x3F,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x80,0x00,0x00,0x01,
+    0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x80,0x01,0x80,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x2A,
+    0x00,0x2A,0x00,0x2A,0x00,0x3C,0x00,0x00,0x80,0x3F,0x00,0x24,0x00,0x22,0x00,0x22,
+    0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x10,0x00,0x00,
+    0x00,0x1C,0x00,0x22,0x00,0x22,0x00,0x24,0x80,0x3F,0x00,0x00,0x00,0x1C,0x00,0x2A,
+    0x00,0x2A,0x00,0x2A,0x00,0x0C,0x00,0x00,0x00,0x04,0x00,0x3F,0x80,0x04,0x80,0x00,
+    0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x2A,0x00,0x2A,0x00,0x2A,0x00,0x1E,0x00,0x00,
+    0x80,0x3F,0x00,0x04,0x00,0x02,0x00,0x02,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x22,
+    0x80,0x3E,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x20,0x00,0x22,0x80,0x1E,
+    0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x08,0x00,0x14,0x00,0x22,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x80,0x20,0x80,0x3F,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x02,
+    0x00,0x0C,0x00,0x02,0x00,0x3C,0x00,0x00,0x00,0x3E,0x00,0x04,0x00,0x02,0x00,0x02,
+    0x00,0x3C,0x00,0x00,0x00,0x1C,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x1C,0x00,0x00,
+    0x00,0x3E,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x0A,
+    0x00,0x0A,0x00,0x0A,0x00,0x3E,0x00,0x00,0x00,0x3E,0x00,0x04,0x00,0x02,0x00,0x02,
+    0x00,0x04,0x00,0x00,0x00,0x24,0x00,0x2A,0x00,0x2A,0x00,0x2A,0x00,0x10,0x00,0x00,
+    0x00,0x02,0x80,0x1F,0x00,0x22,0x00,0x20,0x00,0x10,0x00,0x00,0x00,0x1E,0x00,0x20,
+    0x00,0x20,0x00,0x10,0x00,0x3E,0x00,0x00,0x00,0x0E,0x00,0x10,0x00,0x20,0x00,0x10,
+    0x00,0x0E,0x00,0x00,0x00,0x1E,0x00,0x20,0x00,0x18,0x00,0x20,0x00,0x1E,0x00,0x00,
+    0x00,0x22,0x00,0x14,0x00,0x08,0x00,0x14,0x00,0x22,0x00,0x00,0x00,0x06,0x00,0x28,
+    0x00,0x28,0x00,0x28,0x00,0x1E,0x00,0x00,0x00,0x22,0x00,0x32,0x00,0x2A,0x00,0x26,
+    0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x1B,0x80,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,
+    0x00,0x1B,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0x08,
+    0x00,0x04,0x00,0x00,
+};
+
+#endif
+
+static const gfx_glyph_t GLYPHS[95] = {
+    {     0,  6,  6,   0 },   // 32
+    {     6,  6,  6,   0 },   // '!'
+    {    12,  6,  6,   0 },   // '"'
+    {    18,  6,  6,   0 },   // '#'
+    {    24,  6,  6,   0 },   // '$'
+    {    30,  6,  6,   0 },   // '%'
+    {    36,  6,  6,   0 },   // '&'
+    {    42,  6,  6,   0 },   // '''
+    {    48,  6,  6,   0 },   // '('
+    {    54,  6,  6,   0 },   // ')'
+    {    60,  6,  6,   0 },   // '*'
+    {    66,  6,  6,   0 },   // '+'
+    {    72,  6,  6,   0 },   // ','
+    {    78,  6,  6,   0 },   // '-'
+    {    84,  6,  6,   0 },   // '.'
+    {    90,  6,  6,   0 },   // '/'
+    {    96,  6,  6,   0 },   // '0'
+    {   102,  6,  6,   0 },   // '1'
+    {   108,  6,  6,   0 },   // '2'
+    {   114,  6,  6,   0 },   // '3'
+    {   120,  6,  6,   0 },   // '4'
+    {   126,  6,  6,   0 },   // '5'
+    {   132,  6,  6,   0 },   // '6'
+    {   138,  6,  6,   0 },   // '7'
+    {   144,  6,  6,   0 },   // '8'
+    {   150,  6,  6,   0 },   // '9'
+    {   156,  6,  6,   0 },   // ':'
+    {   162,  6,  6,   0 },   // ';'
+    {   168,  6,  6,   0 },   // '<'
+    {   174,  6,  6,   0 },   // '='
+    {   180,  6,  6,   0 },   // '>'
+    {   186,  6,  6,   0 },   // '?'
+    {   192,  6,  6,   0 },   // '@'
+    {   198,  6,  6,   0 },   // 'A'
+    {   204,  6,  6,   0 },   // 'B'
+    {   210,  6,  6,   0 },   // 'C'
+    {   216,  6,  6,   0 },   // 'D'
+    {   222,  6,  6,   0 },   // 'E'
+    {   228,  6,  6,   0 },   // 'F'
+    {   234,  6,  6,   0 },   // 'G'
+    {   240,  6,  6,   0 },   // 'H'
+    {   246,  6,  6,   0 },   // 'I'
+    {   252,  6,  6,   0 },   // 'J'
+    {   258,  6,  6,   0 },   // 'K'
+    {   264,  6,  6,   0 },   // 'L'
+    {   270,  6,  6,   0 },   // 'M'
+    {   276,  6,  6,   0 },   // 'N'
+    {   282,  6,  6,   0 },   // 'O'
+    {   288,  6,  6,   0 },   // 'P'
+    {   294,  6,  6,   0 },   // 'Q'
+    {   300,  6,  6,   0 },   // 'R'
+    {   306,  6,  6,   0 },   // 'S'
+    {   312,  6,  6,   0 },   // 'T'
+    {   318,  6,  6,   0 },   // 'U'
+    {   324,  6,  6,   0 },   // 'V'
+    {   330,  6,  6,   0 },   // 'W'
+    {   336,  6,  6,   0 },   // 'X'
+    {   342,  6,  6,   0 },   // 'Y'
+    {   348,  6,  6,   0 },   // 'Z'
+    {   354,  6,  6,   0 },   // '['
+    {   360,  6,  6,   0 },   // 92
+    {   366,  6,  6,   0 },   // ']'
+    {   372,  6,  6,   0 },   // '^'
+    {   378,  6,  6,   0 },   // '_'
+    {   384,  6,  6,   0 },   // '`'
+    {   390,  6,  6,   0 },   // 'a'
+    {   396,  6,  6,   0 },   // 'b'
+    {   402,  6,  6,   0 },   // 'c'
+    {   408,  6,  6,   0 },   // 'd'
+    {   414,  6,  6,   0 },   // 'e'
+    {   420,  6,  6,   0 },   // 'f'
+    {   426,  6,  6,   0 },   // 'g'
+    {   432,  6,  6,   0 },   // 'h'
+    {   438,  6,  6,   0 },   // 'i'
+    {   444,  6,  6,   0 },   // 'j'
+    {   450,  6,  6,   0 },   // 'k'
+    {   456,  6,  6,   0 },   // 'l'
+    {   462,  6,  6,   0 },   // 'm'
+    {   468,  6,  6,   0 },   // 'n'
+    {   474,  6,  6,   0 },   // 'o'
+    {   480,  6,  6,   0 },   // 'p'
+    {   486,  6,  6,   0 },   // 'q'
+    {   492,  6,  6,   0 },   // 'r'
+    {   498,  6,  6,   0 },   // 's'
+    {   504,  6,  6,   0 },   // 't'
+    {   510,  6,  6,   0 },   // 'u'
+    {   516,  6,  6,   0 },   // 'v'
+    {   522,  6,  6,   0 },   // 'w'
+    {   528,  6,  6,   0 },   // 'x'
+    {   534,  6,  6,   0 },   // 'y'
+    {   540,  6,  6,   0 },   // 'z'
+    {   546,  6,  6,   0 },   // '{'
+    {   552,  6,  6,   0 },   // '|'
+    {   558,  6,  6,   0 },   // '}'
+    {   564,  6,  6,   0 },   // '~'
+};
+
+const gfx_font_t gfx_font_5x7 = {
+    .first = 32, .count = 95, .default_char = 63,
+    .height = 7, .pages = 1, .line_height = 8,
+    .flags = GFX_FONT_CELLS,
+    .glyphs = GLYPHS,
+    .cols = COLS,
+#if GFX_FONT_SHIFTED
+    .shifted = { NULL, SHIFT1, SHIFT2, SHIFT3, SHIFT4, SHIFT5, SHIFT6, SHIFT7 },
+#endif
+};
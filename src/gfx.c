@@ -1,104 +1,247 @@
 // src/gfx.c
 #include "gfx.h"
+#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 
-// 5x7 ASCII font (32..126); columns are vertical, LSB = top pixel
-static const uint8_t FONT5x7[95][5] = {
-  {0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x5F,0x00,0x00},{0x00,0x07,0x00,0x07,0x00},
-  {0x14,0x7F,0x14,0x7F,0x14},{0x24,0x2A,0x7F,0x2A,0x12},{0x23,0x13,0x08,0x64,0x62},
-  {0x36,0x49,0x55,0x22,0x50},{0x00,0x05,0x03,0x00,0x00},{0x00,0x1C,0x22,0x41,0x00},
-  {0x00,0x41,0x22,0x1C,0x00},{0x14,0x08,0x3E,0x08,0x14},{0x08,0x08,0x3E,0x08,0x08},
-  {0x00,0x50,0x30,0x00,0x00},{0x08,0x08,0x08,0x08,0x08},{0x00,0x60,0x60,0x00,0x00},
-  {0x20,0x10,0x08,0x04,0x02},{0x3E,0x51,0x49,0x45,0x3E},{0x00,0x42,0x7F,0x40,0x00},
-  {0x42,0x61,0x51,0x49,0x46},{0x21,0x41,0x45,0x4B,0x31},{0x18,0x14,0x12,0x7F,0x10},
-  {0x27,0x45,0x45,0x45,0x39},{0x3C,0x4A,0x49,0x49,0x30},{0x01,0x71,0x09,0x05,0x03},
-  {0x36,0x49,0x49,0x49,0x36},{0x06,0x49,0x49,0x29,0x1E},{0x00,0x36,0x36,0x00,0x00},
-  {0x00,0x56,0x36,0x00,0x00},{0x08,0x14,0x22,0x41,0x00},{0x14,0x14,0x14,0x14,0x14},
-  {0x00,0x41,0x22,0x14,0x08},{0x02,0x01,0x51,0x09,0x06},{0x32,0x49,0x79,0x41,0x3E},
-  {0x7E,0x11,0x11,0x11,0x7E},{0x7F,0x49,0x49,0x49,0x36},{0x3E,0x41,0x41,0x41,0x22},
-  {0x7F,0x41,0x41,0x22,0x1C},{0x7F,0x49,0x49,0x49,0x41},{0x7F,0x09,0x09,0x09,0x01},
-  {0x3E,0x41,0x49,0x49,0x7A},{0x7F,0x08,0x08,0x08,0x7F},{0x00,0x41,0x7F,0x41,0x00},
-  {0x20,0x40,0x41,0x3F,0x01},{0x7F,0x08,0x14,0x22,0x41},{0x7F,0x40,0x40,0x40,0x40},
-  {0x7F,0x02,0x0C,0x02,0x7F},{0x7F,0x04,0x08,0x10,0x7F},{0x3E,0x41,0x41,0x41,0x3E},
-  {0x7F,0x09,0x09,0x09,0x06},{0x3E,0x41,0x51,0x21,0x5E},{0x7F,0x09,0x19,0x29,0x46},
-  {0x46,0x49,0x49,0x49,0x31},{0x01,0x01,0x7F,0x01,0x01},{0x3F,0x40,0x40,0x40,0x3F},
-  {0x1F,0x20,0x40,0x20,0x1F},{0x7F,0x20,0x18,0x20,0x7F},{0x63,0x14,0x08,0x14,0x63},
-  {0x07,0x08,0x70,0x08,0x07},{0x61,0x51,0x49,0x45,0x43},{0x00,0x7F,0x41,0x41,0x00},
-  {0x02,0x04,0x08,0x10,0x20},{0x00,0x41,0x41,0x7F,0x00},{0x04,0x02,0x01,0x02,0x04},
-  {0x80,0x80,0x80,0x80,0x80},{0x00,0x03,0x05,0x00,0x00},{0x20,0x54,0x54,0x54,0x78},
-  {0x7F,0x48,0x44,0x44,0x38},{0x38,0x44,0x44,0x44,0x20},{0x38,0x44,0x44,0x48,0x7F},
-  {0x38,0x54,0x54,0x54,0x18},{0x08,0x7E,0x09,0x01,0x02},{0x08,0x54,0x54,0x54,0x3C},
-  {0x7F,0x08,0x04,0x04,0x78},{0x00,0x44,0x7D,0x40,0x00},{0x20,0x40,0x44,0x3D,0x00},
-  {0x7F,0x10,0x28,0x44,0x00},{0x00,0x41,0x7F,0x40,0x00},{0x7C,0x04,0x18,0x04,0x78},
-  {0x7C,0x08,0x04,0x04,0x78},{0x38,0x44,0x44,0x44,0x38},{0x7C,0x14,0x14,0x14,0x08},
-  {0x08,0x14,0x14,0x14,0x7C},{0x7C,0x08,0x04,0x04,0x08},{0x48,0x54,0x54,0x54,0x20},
-  {0x04,0x3F,0x44,0x40,0x20},{0x3C,0x40,0x40,0x20,0x7C},{0x1C,0x20,0x40,0x20,0x1C},
-  {0x3C,0x40,0x30,0x40,0x3C},{0x44,0x28,0x10,0x28,0x44},{0x0C,0x50,0x50,0x50,0x3C},
-  {0x44,0x64,0x54,0x4C,0x44},{0x00,0x08,0x36,0x41,0x00},{0x00,0x00,0x7F,0x00,0x00},
-  {0x00,0x41,0x36,0x08,0x00},{0x10,0x08,0x08,0x10,0x08}
-};
-
-void gfx_set_pixel(ssd1306_t *dev, int x, int y, int on) {
-    if (!dev || !dev->buffer) return;
-    if ((unsigned)x >= dev->width || (unsigned)y >= dev->height) return;
-    size_t idx = (size_t)(y >> 3) * dev->width + (size_t)x;
+// ---------- Geometry ----------
+// In a fixed-geometry build (FIXED=WxH) the panel's dev->surface has a
+// compile-time size, like the driver's framebuffer. The kernels that index
+// rows or clip take the surface's width W, pages P and whether the clip is the
+// whole surface as arguments, and GFX_GEOM() instantiates them twice: with
+// constants for an unclipped surface of the panel's size, so stride and clip
+// fold away, and with the run-time values for any other.
+#ifdef SSD1306_FIXED_WIDTH
+#define GFX_KERNEL  static inline __attribute__((always_inline))
+#define GFX_PANEL(s)                                                                   \
+    ((s)->width == SSD1306_FIXED_WIDTH && (s)->pages == SSD1306_FIXED_HEIGHT / 8 &&    \
+     (s)->clip_x0 == 0 && (s)->clip_x1 == SSD1306_FIXED_WIDTH - 1 &&                   \
+     (s)->clip_y0 == 0 && (s)->clip_y1 == SSD1306_FIXED_HEIGHT - 1)
+#define GFX_GEOM(s, kernel, ...)                                                       \
+    (GFX_PANEL(s) ? kernel(SSD1306_FIXED_WIDTH, SSD1306_FIXED_HEIGHT / 8, true, __VA_ARGS__) \
+                  : kernel((s)->width, (s)->pages, false, __VA_ARGS__))
+#else
+#define GFX_KERNEL  static inline
+#define GFX_GEOM(s, kernel, ...)  kernel((s)->width, (s)->pages, false, __VA_ARGS__)
+#endif
+
+// ---------- Surfaces ----------
+void gfx_set_clip(gfx_surface_t *s, int x, int y, int w, int h) {
+    if (!s) return;
+    const long ex = (long)x + w - 1, ey = (long)y + h - 1;
+    s->clip_x0 = (int16_t)(x < 0 ? 0 : x > s->width ? s->width : x);
+    s->clip_y0 = (int16_t)(y < 0 ? 0 : y > s->height ? s->height : y);
+    s->clip_x1 = (int16_t)(ex >= s->width ? s->width - 1 : ex < -1 ? -1 : ex);
+    s->clip_y1 = (int16_t)(ey >= s->height ? s->height - 1 : ey < -1 ? -1 : ey);
+    if (w <= 0 || h <= 0) { s->clip_x0 = 0; s->clip_x1 = -1; }
+}
+
+void gfx_reset_clip(gfx_surface_t *s) {
+    if (s) gfx_set_clip(s, 0, 0, s->width, s->height);
+}
+
+GFX_KERNEL void set_pixel(int W, int P, bool whole, gfx_surface_t *s, int x, int y, int on) {
+    (void)P; (void)whole;
+    size_t idx = (size_t)(y >> 3) * (size_t)W + (size_t)x;
     uint8_t mask = (uint8_t)(1u << (y & 7));
-    if (on) dev->buffer[idx] |= mask;
-    else    dev->buffer[idx] &= (uint8_t)~mask;
-}
-
-void gfx_draw_char(ssd1306_t *dev, int x, int y, char c) {
-    if (!dev || !dev->buffer) return;
-    if (c < 32 || c > 126) c = '?';
-    const uint8_t *g = FONT5x7[(uint8_t)c - 32];
-    for (int col = 0; col < 5; ++col) {
-        uint8_t bits = g[col];
-        for (int row = 0; row < 7; ++row) {
-            gfx_set_pixel(dev, x + col, y + row, (bits >> row) & 1);
-        }
+    if (on) s->buf[idx] |= mask;
+    else    s->buf[idx] &= (uint8_t)~mask;
+    gfx_surface_mark(s, y >> 3, x, x);
+}
+
+void gfx_set_pixel(gfx_surface_t *s, int x, int y, int on) {
+    if (!s || !s->buf) return;
+    if (x < s->clip_x0 || x > s->clip_x1 || y < s->clip_y0 || y > s->clip_y1) return;
+    GFX_GEOM(s, set_pixel, s, x, y, on);
+}
+
+// ---------- Text: font atlases ----------
+// Glyph columns are stored in page order (LSB = top), so text is written a
+// whole column byte at a time. Text replaces the box it covers (cell height x
+// summed advances); rows of a page outside the cell keep whatever was there.
+
+static inline const gfx_glyph_t *font_glyph(const gfx_font_t *font, uint8_t code) {
+    if (code < font->first || code >= (unsigned)font->first + font->count) code = font->default_char;
+    return &font->glyphs[code - font->first];
+}
+
+const gfx_glyph_t *gfx_font_glyph(const gfx_font_t *font, char c) {
+    return font ? font_glyph(font, (uint8_t)c) : NULL;
+}
+
+int gfx_font_kern(const gfx_font_t *font, char left, char right) {
+    if (!font) return 0;
+    const unsigned key = (unsigned)(uint8_t)left << 8 | (uint8_t)right;
+    size_t lo = 0, hi = font->nkern;
+    while (lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        if (font->kern[mid].pair == key) return font->kern[mid].dx;
+        if (font->kern[mid].pair < key) lo = mid + 1; else hi = mid;
+    }
+    return 0;
+}
+
+static int text_width_n(const gfx_font_t *font, const char *s, size_t n) {
+    int w = 0;
+    for (size_t i = 0; i < n; ++i) {
+        w += font_glyph(font, (uint8_t)s[i])->advance;
+        if (font->nkern && i + 1 < n) w += gfx_font_kern(font, s[i], s[i + 1]);
     }
-    // 1px spacing column
-    for (int row = 0; row < 7; ++row) gfx_set_pixel(dev, x + 5, y + row, 0);
+    return w;
 }
 
-void gfx_draw_text(ssd1306_t *dev, int x, int y, const char *s) {
-    if (!dev || !dev->buffer || !s) return;
-    int cx = x;
-    while (*s) {
-        gfx_draw_char(dev, cx, y, *s++);
-        cx += 6;
+int gfx_font_text_width(const gfx_font_t *font, const char *s) {
+    if (!font || !s) return 0;
+    return text_width_n(font, s, strlen(s));
+}
+
+// Byte k of glyph atlas column 'col' moved down by 'sh' rows: read from the
+// pre-shifted copy ('atlas', 'stride' bytes per column) when there is one.
+static inline uint8_t col_byte(const gfx_font_t *font, const uint8_t *atlas, int stride,
+                               size_t col, int k, int sh) {
+    if (atlas) return atlas[col * (size_t)stride + (size_t)k];
+    const uint8_t *b = &font->cols[col * font->pages];
+    uint32_t v = 0;
+    for (int i = 0; i < font->pages; ++i) v |= (uint32_t)b[i] << (8 * i);
+    return (uint8_t)((v << sh) >> (8 * k));
+}
+
+// Draw n characters of s with the cell's top-left at (x, y). A column at row
+// shift 'sh' spans 'stride' pages from pg. Fonts stored as whole cells are
+// written with a masked store per column byte; otherwise the text box is
+// cleared first and the ink ORed in, so kerned or overhanging glyphs keep
+// their neighbours' pixels. Columns [xl, xe) and the rows in 'ink' are the clip.
+GFX_KERNEL void blit_text_k(int W, int P, bool whole, gfx_surface_t *surf, const gfx_font_t *font,
+                            int x, int y, const char *s, size_t n) {
+    const int xl = whole ? 0 : surf->clip_x0, xe = whole ? W : surf->clip_x1 + 1;
+
+    const int pg = (y >= 0) ? (y >> 3) : -((7 - y) >> 3);      // floor(y / 8)
+    const int sh = y - pg * 8;
+    const int last = (y + font->height - 1) >> 3;               // last page with cell rows
+    const int stride = font->pages + (sh ? 1 : 0);              // bytes per column
+    const uint8_t *atlas = sh ? font->shifted[sh] : font->cols;
+    const uint32_t cell = ((1u << font->height) - 1u) << sh;
+
+    // Destination row and cell-row mask of each column byte k (row NULL: off-screen)
+    uint8_t *row[GFX_FONT_MAX_HEIGHT / 8 + 1];
+    uint8_t keep[GFX_FONT_MAX_HEIGHT / 8 + 1];
+    uint8_t ink[GFX_FONT_MAX_HEIGHT / 8 + 1];
+    int p0 = P, p1 = -1;
+    for (int k = 0; k < stride; ++k) {
+        const int p = pg + k;
+        ink[k] = (p >= 0 && p < P && p <= last) ? (whole ? 0xFF : gfx_surface_clip_rows(surf, p)) : 0;
+        row[k] = ink[k] ? &surf->buf[(size_t)p * W] : NULL;
+        keep[k] = (uint8_t)(~(cell >> (8 * k)) | ~ink[k]);
+        if (row[k]) { if (p < p0) p0 = p; p1 = p; }
     }
+
+    int x0, x1;                                                 // columns to mark dirty
+    if ((font->flags & GFX_FONT_CELLS) && !font->nkern) {
+        // Each cell is a masked column copy: one pass per page over the string,
+        // or a single pass for the common 1-page font straddling two pages
+        int pen = x;
+        const bool pair = atlas && stride == 2 && row[0] && row[1];
+        for (size_t i = 0; pair && i < n && pen < xe; ++i) {
+            const gfx_glyph_t *g = font_glyph(font, (uint8_t)s[i]);
+            const int c0 = pen < xl ? xl - pen : 0;
+            const int c1 = pen + g->width > xe ? xe - pen : g->width;
+            const uint8_t *src = &atlas[(size_t)g->offset * 2];
+            uint8_t *lo = row[0] + pen, *hi = row[1] + pen;
+            for (int c = c0; c < c1; ++c) {
+                lo[c] = (uint8_t)((lo[c] & keep[0]) | (src[2 * c] & (whole ? 0xFF : ink[0])));
+                hi[c] = (uint8_t)((hi[c] & keep[1]) | (src[2 * c + 1] & (whole ? 0xFF : ink[1])));
+            }
+            pen += g->width;
+        }
+        for (int k = 0; k < stride && !pair; ++k) {
+            if (!row[k]) continue;
+            const uint8_t kp = keep[k], in = whole ? 0xFF : ink[k];
+            pen = x;
+            for (size_t i = 0; i < n && pen < xe; ++i) {
+                const gfx_glyph_t *g = font_glyph(font, (uint8_t)s[i]);
+                const int c0 = pen < xl ? xl - pen : 0;
+                const int c1 = pen + g->width > xe ? xe - pen : g->width;
+                uint8_t *dst = row[k] + pen;
+                if (atlas) {
+                    const uint8_t *src = &atlas[(size_t)g->offset * stride + (size_t)k];
+                    for (int c = c0; c < c1; ++c) dst[c] = (uint8_t)((dst[c] & kp) | (src[c * stride] & in));
+                } else {
+                    for (int c = c0; c < c1; ++c)
+                        dst[c] = (uint8_t)((dst[c] & kp) | (col_byte(font, NULL, stride, (size_t)(g->offset + c), k, sh) & in));
+                }
+                pen += g->width;
+            }
+        }
+        x0 = x < xl ? xl : x;
+        x1 = (pen > xe ? xe : pen) - 1;
+    } else {
+        gfx_fill_rect(surf, x, y, text_width_n(font, s, n), font->height, 0);
+        x0 = xe; x1 = -1;
+        int pen = x;
+        for (size_t i = 0; i < n && pen < xe + 128; ++i) {      // bearing >= -128: rest is clipped
+            const gfx_glyph_t *g = font_glyph(font, (uint8_t)s[i]);
+            const int cx = pen + g->bearing;
+            pen += g->advance;
+            if (font->nkern && i + 1 < n) pen += gfx_font_kern(font, s[i], s[i + 1]);
+
+            int j0 = 0, j1 = g->width;
+            if (cx < xl) j0 = xl - cx;
+            if (cx + j1 > xe) j1 = xe - cx;
+            if (j0 >= j1) continue;
+            if (cx + j0 < x0) x0 = cx + j0;
+            if (cx + j1 - 1 > x1) x1 = cx + j1 - 1;
+            for (int k = 0; k < stride; ++k) {
+                if (!row[k]) continue;
+                uint8_t *dst = row[k] + cx;
+                for (int j = j0; j < j1; ++j) dst[j] |= col_byte(font, atlas, stride, (size_t)(g->offset + j), k, sh) & ink[k];
+            }
+        }
+        // The clear marked the box; this covers ink that reaches past it
+    }
+    for (int p = p0; p <= p1 && x0 <= x1; ++p) gfx_surface_mark(surf, p, x0, x1);
+}
+
+static void blit_text(gfx_surface_t *surf, const gfx_font_t *font, int x, int y, const char *s, size_t n) {
+    if (n == 0 || y + (int)font->height <= surf->clip_y0 || y > surf->clip_y1) return;
+    GFX_GEOM(surf, blit_text_k, surf, font, x, y, s, n);
+}
+
+void gfx_draw_text_font(gfx_surface_t *s, const gfx_font_t *font, int x, int y, const char *text) {
+    if (!s || !s->buf || !font || !text) return;
+    blit_text(s, font, x, y, text, strlen(text));
+}
+
+void gfx_draw_char(gfx_surface_t *s, int x, int y, char c) {
+    if (!s || !s->buf) return;
+    blit_text(s, &gfx_font_5x7, x, y, &c, 1);
 }
 
-int gfx_text_rows(const ssd1306_t *dev) {
-    if (!dev) return 0;
-    return dev->height / 8; // one text row per page (8px)
+void gfx_draw_text(gfx_surface_t *s, int x, int y, const char *text) {
+    if (!s || !s->buf || !text) return;
+    blit_text(s, &gfx_font_5x7, x, y, text, strlen(text));
+}
+
+int gfx_text_rows(const gfx_surface_t *s) {
+    if (!s) return 0;
+    return s->height / 8; // one text row per page (8px)
 }
 
 int gfx_text_width(const char *s) {
     if (!s) return 0;
-    size_t n = strlen(s);
-    // If you ever add proportional fonts, compute width per glyph here.
-    return (int)(n * GFX_CHAR_ADVANCE);
+    return gfx_font_text_width(&gfx_font_5x7, s);
 }
 
-int gfx_clear_line(ssd1306_t *dev, int row) {
-    if (!dev || !dev->buffer) return -1;
-    int rows = gfx_text_rows(dev);
+int gfx_clear_line(gfx_surface_t *s, int row) {
+    if (!s || !s->buf) return -1;
+    int rows = gfx_text_rows(s);
     if (row < 0 || row >= rows) return -2;
-    // Each "row" == 1 page (8px high). Clear one page worth of bytes.
-    memset(&dev->buffer[(size_t)row * dev->width], 0x00, (size_t)dev->width);
+    // Each "row" == 1 page (8px high): a single memset when nothing clips it
+    gfx_fill_rect(s, 0, row * 8, s->width, 8, 0);
     return 0;
 }
 
-int gfx_print_line(ssd1306_t *dev, const char *text, int row, int alignment_or_x) {
-    if (!dev || !dev->buffer || !text) return -1;
-    int rows = gfx_text_rows(dev);
-    if (row < 0 || row >= rows) return -2;
-
-    // Compute y as top pixel of the text row. (Row height = 8 px; font is 7 px tall.)
-    int y = row * 8;
+int gfx_align_x(const gfx_surface_t *s, const char *text, int alignment_or_x) {
+    if (!s || !text) return 0;
 
     // Compute x from alignment keyword or explicit x
     int text_px = gfx_text_width(text);
@@ -106,9 +249,9 @@ int gfx_print_line(ssd1306_t *dev, const char *text, int row, int alignment_or_x
     if (alignment_or_x == GFX_ALIGN_LEFT) {
         x = 0;
     } else if (alignment_or_x == GFX_ALIGN_CENTER || alignment_or_x == GFX_ALIGN_CENTRE) {
-        x = (dev->width - text_px) / 2;
+        x = (s->width - text_px) / 2;
     } else if (alignment_or_x == GFX_ALIGN_RIGHT) {
-        x = dev->width - text_px;
+        x = s->width - text_px;
     } else {
         // Treat any non-negative value as explicit x position
         x = alignment_or_x;
@@ -116,30 +259,310 @@ int gfx_print_line(ssd1306_t *dev, const char *text, int row, int alignment_or_x
 
     // Clamp x into a safe drawable range
     if (x < 0) x = 0;
-    if (x > (int)dev->width - 1) x = (int)dev->width - 1;
+    if (x > (int)s->width - 1) x = (int)s->width - 1;
+    return x;
+}
+
+int gfx_print_line(gfx_surface_t *s, const char *text, int row, int alignment_or_x) {
+    if (!s || !s->buf || !text) return -1;
+    int rows = gfx_text_rows(s);
+    if (row < 0 || row >= rows) return -2;
+
+    // Compute y as top pixel of the text row. (Row height = 8 px; font is 7 px tall.)
+    int y = row * 8;
 
     // Draw (existing draw routines already clip to framebuffer bounds)
-    gfx_draw_text(dev, x, y, text);
+    gfx_draw_text(s, gfx_align_x(s, text, alignment_or_x), y, text);
     return 0;
 }
 
-void gfx_fill_rect(ssd1306_t *dev, int x, int y, int w, int h, int on) {
-    if (!dev || !dev->buffer || w <= 0 || h <= 0) return;
-    for (int yy = 0; yy < h; ++yy) {
-        for (int xx = 0; xx < w; ++xx) {
-            gfx_set_pixel(dev, x + xx, y + yy, on);
+// ---------- Rectangles: page-byte kernels ----------
+// Set/clear the pixel rectangle x, y, w, h, clipped, one page at a time:
+// whole pages inside the rectangle are a memset, the partial top/bottom pages
+// apply one computed bit mask to the column run.
+GFX_KERNEL void fill_rect_k(int W, int P, bool whole, gfx_surface_t *s, int x, int y, int w_px, int h_px, int on) {
+    if (w_px <= 0 || h_px <= 0) return;
+    const long ex = (long)x + w_px - 1, ey = (long)y + h_px - 1;
+    const int cx0 = whole ? 0 : s->clip_x0, cx1 = whole ? W - 1 : s->clip_x1;
+    const int cy0 = whole ? 0 : s->clip_y0, cy1 = whole ? 8 * P - 1 : s->clip_y1;
+    const int x0 = x < cx0 ? cx0 : x, y0 = y < cy0 ? cy0 : y;
+    const int x1 = ex > cx1 ? cx1 : (int)ex, y1 = ey > cy1 ? cy1 : (int)ey;
+    if (x0 > x1 || y0 > y1) return;
+
+    const size_t w = (size_t)(x1 - x0 + 1);
+    const int p0 = y0 >> 3, p1 = y1 >> 3;
+    for (int p = p0; p <= p1; ++p) {
+        const int top = (p == p0) ? (y0 & 7) : 0;
+        const int bot = (p == p1) ? (y1 & 7) : 7;
+        const uint8_t mask = (uint8_t)((0xFFu >> (7 - bot)) & (0xFFu << top));
+        uint8_t *row = &s->buf[(size_t)p * W + (size_t)x0];
+        if (mask == 0xFF) {
+            // Full-width runs of whole pages are contiguous: one memset for all
+            int q = p;
+            if (w == (size_t)W) while (q < p1 && (q + 1 < p1 || (y1 & 7) == 7)) ++q;
+            memset(row, on ? 0xFF : 0x00, w * (size_t)(q - p + 1));
+            for (; p < q; ++p) gfx_surface_mark(s, p, x0, x1);
+        } else if (on) {
+            for (size_t i = 0; i < w; ++i) row[i] |= mask;
+        } else {
+            const uint8_t keep = (uint8_t)~mask;
+            for (size_t i = 0; i < w; ++i) row[i] &= keep;
         }
+        gfx_surface_mark(s, p, x0, x1);
     }
 }
 
-void gfx_draw_rect(ssd1306_t *dev, int x, int y, int w, int h, int on) {
-    if (!dev || !dev->buffer || w <= 0 || h <= 0) return;
-    for (int xx = 0; xx < w; ++xx) {
-        gfx_set_pixel(dev, x + xx, y, on);
-        gfx_set_pixel(dev, x + xx, y + h - 1, on);
+// Clip a rectangle to the clip rectangle; returns false when nothing is visible.
+static bool clip_rect(const gfx_surface_t *s, int x, int y, int w, int h,
+                      int *x0, int *y0, int *x1, int *y1) {
+    if (w <= 0 || h <= 0) return false;
+    long ex = (long)x + w - 1, ey = (long)y + h - 1;
+    *x0 = x < s->clip_x0 ? s->clip_x0 : x;
+    *y0 = y < s->clip_y0 ? s->clip_y0 : y;
+    *x1 = ex > s->clip_x1 ? s->clip_x1 : (int)ex;
+    *y1 = ey > s->clip_y1 ? s->clip_y1 : (int)ey;
+    return *x0 <= *x1 && *y0 <= *y1;
+}
+
+void gfx_fill_rect(gfx_surface_t *s, int x, int y, int w, int h, int on) {
+    if (!s || !s->buf) return;
+    GFX_GEOM(s, fill_rect_k, s, x, y, w, h, on);
+}
+
+void gfx_draw_rect(gfx_surface_t *s, int x, int y, int w, int h, int on) {
+    if (!s || !s->buf || w <= 0 || h <= 0) return;
+    // Four 1px edges, each a fill: rows become one mask per column run,
+    // columns one mask per page.
+    gfx_fill_rect(s, x, y, w, 1, on);
+    gfx_fill_rect(s, x, y + h - 1, w, 1, on);
+    gfx_fill_rect(s, x, y, 1, h, on);
+    gfx_fill_rect(s, x + w - 1, y, 1, h, on);
+}
+
+// ---------- Surface copy: page-shifted raster ops ----------
+// Column runs are processed eight bytes per 64-bit word. Per-byte shifts are
+// word shifts with the bits that crossed into a neighbouring byte masked off,
+// which holds in either byte order.
+#define BYTES8(b)  (0x0101010101010101ull * (uint8_t)(b))
+
+static inline uint64_t load8(const uint8_t *p) { uint64_t v; memcpy(&v, p, 8); return v; }
+static inline void store8(uint8_t *p, uint64_t v) { memcpy(p, &v, 8); }
+
+// The n source bytes for one destination page: rows 'sh'.. of page 'lo', the
+// rest from the next page 'hi' (either NULL: outside the source, read as
+// blank; its rows are masked off by the caller). An aligned row is used in place.
+static const uint8_t *gather(uint8_t *tmp, const uint8_t *lo, const uint8_t *hi, int sh, int n) {
+    static const uint8_t blank[GFX_SURFACE_MAX_WIDTH];
+    if (!lo) lo = blank;
+    if (!sh) return lo;
+    if (!hi) hi = blank;
+    const int up = 8 - sh;
+    const uint64_t ml = BYTES8(0xFFu >> sh), mh = BYTES8(0xFFu << up);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) store8(tmp + i, (load8(lo + i) >> sh & ml) | (load8(hi + i) << up & mh));
+    for (; i < n; ++i) tmp[i] = (uint8_t)(lo[i] >> sh | hi[i] << up);
+    return tmp;
+}
+
+static inline uint64_t rop_apply(gfx_rop_t rop, uint64_t d, uint64_t s, uint64_t m) {
+    switch (rop) {
+    case GFX_ROP_OR:  return d | (s & m);
+    case GFX_ROP_AND: return d & (s | ~m);
+    case GFX_ROP_XOR: return d ^ (s & m);
+    default:          return (d & ~m) | (s & m);
     }
-    for (int yy = 0; yy < h; ++yy) {
-        gfx_set_pixel(dev, x, y + yy, on);
-        gfx_set_pixel(dev, x + w - 1, y + yy, on);
+}
+
+// dst[i] = src[i] under 'rop', rows 'm' of each byte only.
+static void rop_run(uint8_t *dst, const uint8_t *src, int n, uint8_t m, gfx_rop_t rop) {
+    if (rop == GFX_ROP_COPY && m == 0xFF) { memcpy(dst, src, (size_t)n); return; }
+    const uint64_t m8 = BYTES8(m);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) store8(dst + i, rop_apply(rop, load8(dst + i), load8(src + i), m8));
+    for (; i < n; ++i) dst[i] = (uint8_t)rop_apply(rop, dst[i], src[i], m);
+}
+
+// Combine dst columns [x0, x1] x rows [y0, y1] (clipped, inclusive) with the
+// pixels at (x - ox, y - oy) of page-major 'src' ('sw' bytes per page, 'sp'
+// pages) under 'rop'. Whatever the vertical offset, a destination page is a
+// gather of shifted source bytes plus one masked run.
+static void copy_clipped(gfx_surface_t *d, int x0, int y0, int x1, int y1,
+                         const uint8_t *src, int sw, int sp, int ox, int oy, gfx_rop_t rop) {
+    const int n = x1 - x0 + 1;
+    uint8_t tmp[GFX_SURFACE_MAX_WIDTH];
+    for (int p = y0 >> 3; p <= y1 >> 3; ++p) {
+        const int top = (p == y0 >> 3) ? (y0 & 7) : 0;
+        const int bot = (p == y1 >> 3) ? (y1 & 7) : 7;
+        const uint8_t m = (uint8_t)((0xFFu >> (7 - bot)) & (0xFFu << top));
+
+        const int r = 8 * p - oy;                               // source row of this page's bit 0
+        const int q = (r >= 0) ? (r >> 3) : -((7 - r) >> 3);    // floor(r / 8)
+        const size_t sx = (size_t)(x0 - ox);
+        const uint8_t *lo = (q >= 0 && q < sp) ? &src[(size_t)q * sw + sx] : NULL;
+        const uint8_t *hi = (q + 1 >= 0 && q + 1 < sp) ? &src[(size_t)(q + 1) * sw + sx] : NULL;
+        rop_run(&d->buf[(size_t)p * d->width + (size_t)x0], gather(tmp, lo, hi, r - 8 * q, n), n, m, rop);
+        gfx_surface_mark(d, p, x0, x1);
+    }
+}
+
+void gfx_copy(gfx_surface_t *dst, int dx, int dy, const gfx_surface_t *src,
+              int sx, int sy, int w, int h, gfx_rop_t rop) {
+    if (!dst || !dst->buf || !src || !src->buf || (unsigned)rop > GFX_ROP_XOR) return;
+    // Trim the source rectangle to the source, then its image to the clip
+    if (sx < 0) { w += sx; dx -= sx; sx = 0; }
+    if (sy < 0) { h += sy; dy -= sy; sy = 0; }
+    if (w > src->width - sx)  w = src->width - sx;
+    if (h > src->height - sy) h = src->height - sy;
+    int x0, y0, x1, y1;
+    if (!clip_rect(dst, dx, dy, w, h, &x0, &y0, &x1, &y1)) return;
+    copy_clipped(dst, x0, y0, x1, y1, src->buf, src->width, src->pages, dx - sx, dy - sy, rop);
+}
+
+void gfx_blit(gfx_surface_t *s, int x, int y, const gfx_bitmap_t *bm, gfx_rop_t rop) {
+    if (!s || !s->buf || !bm || !bm->data || (unsigned)rop > GFX_ROP_XOR) return;
+    int x0, y0, x1, y1;
+    if (!clip_rect(s, x, y, bm->width, bm->height, &x0, &y0, &x1, &y1)) return;
+    copy_clipped(s, x0, y0, x1, y1, bm->data, bm->width, (bm->height + 7) / 8, x, y, rop);
+}
+
+// ---------- Lines and circles: pixel runs ----------
+// Both split their pixels into runs instead of plotting them one by one. A
+// vertical run (steep line, side of a circle) is one byte mask per page it
+// covers. A horizontal run (shallow line, top of a circle) is one bit per
+// column byte and a single dirty mark.
+
+// Rows [ya, yb] (either order) of column x, clipped.
+static inline void vrun(gfx_surface_t *s, int x, int ya, int yb, int on) {
+    if (ya > yb) { const int t = ya; ya = yb; yb = t; }
+    if (x < s->clip_x0 || x > s->clip_x1 || yb < s->clip_y0 || ya > s->clip_y1) return;
+    if (ya < s->clip_y0) ya = s->clip_y0;
+    if (yb > s->clip_y1) yb = s->clip_y1;
+    uint8_t *col = &s->buf[x];
+    const int p0 = ya >> 3, p1 = yb >> 3;
+    if (p0 == p1) {                                     // the common short run: one byte
+        const uint8_t m = (uint8_t)((0xFFu >> (7 - (yb & 7))) & (0xFFu << (ya & 7)));
+        uint8_t *b = &col[(size_t)p0 * s->width];
+        *b = on ? (uint8_t)(*b | m) : (uint8_t)(*b & ~m);
+        gfx_surface_mark(s, p0, x, x);
+        return;
     }
-}
\ No newline at end of file
+    for (int p = p0; p <= p1; ++p) {
+        const int top = (p == p0) ? (ya & 7) : 0;
+        const int bot = (p == p1) ? (yb & 7) : 7;
+        const uint8_t m = (uint8_t)((0xFFu >> (7 - bot)) & (0xFFu << top));
+        uint8_t *b = &col[(size_t)p * s->width];
+        *b = on ? (uint8_t)(*b | m) : (uint8_t)(*b & ~m);
+        gfx_surface_mark(s, p, x, x);
+    }
+}
+
+// Columns [xa, xb] of row y, clipped: one bit per byte.
+static inline void hrun(gfx_surface_t *s, int xa, int xb, int y, int on) {
+    if (y < s->clip_y0 || y > s->clip_y1 || xb < s->clip_x0 || xa > s->clip_x1) return;
+    if (xa < s->clip_x0) xa = s->clip_x0;
+    if (xb > s->clip_x1) xb = s->clip_x1;
+    uint8_t *row = &s->buf[(size_t)(y >> 3) * s->width];
+    const uint8_t bit = (uint8_t)(1u << (y & 7));
+    if (on) for (int x = xa; x <= xb; ++x) row[x] |= bit;
+    else    for (int x = xa; x <= xb; ++x) row[x] &= (uint8_t)~bit;
+    gfx_surface_mark(s, y >> 3, xa, xb);
+}
+
+void gfx_draw_line(gfx_surface_t *s, int x0, int y0, int x1, int y1, int on) {
+    if (!s || !s->buf) return;
+    if (x0 > x1) { int t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }    // left to right
+    if (x1 < s->clip_x0 || x0 > s->clip_x1) return;
+    if ((y0 < s->clip_y0 && y1 < s->clip_y0) || (y0 > s->clip_y1 && y1 > s->clip_y1)) return;
+    if (y0 == y1) {
+        gfx_fill_rect(s, x0, y0, x1 - x0 + 1, 1, on);
+        return;
+    }
+
+    // Bresenham
+    const int sy = y0 < y1 ? 1 : -1;
+    const long dx = (long)x1 - x0, dy = sy * ((long)y1 - y0);
+    long err = dx - dy;
+    int x = x0, y = y0;
+    if (dx >= dy) {
+        // Shallow: one pixel per column, runs of columns share a row
+        int xa = x;
+        for (;;) {
+            if (x == x1 || x >= s->clip_x1) { hrun(s, xa, x, y, on); return; }
+            const long e2 = 2 * err;
+            err -= dy;
+            if (e2 <= dx) {
+                hrun(s, xa, x, y, on);
+                err += dx;
+                y += sy;
+                xa = x + 1;
+            }
+            ++x;
+        }
+    }
+
+    // Steep: each column is a run of rows, 'ya' is where the current one started
+    int ya = y0;
+    while (x != x1 || y != y1) {
+        const long e2 = 2 * err;
+        const bool stepx = e2 >= -dy, stepy = e2 <= dx;
+        if (stepx) {
+            vrun(s, x, ya, y, on);
+            if (x >= s->clip_x1) return;                // everything further right is clipped
+            err -= dy;
+            ++x;
+        }
+        if (stepy) { err += dx; y += sy; }
+        if (stepx) ya = y;
+    }
+    vrun(s, x, ya, y, on);
+}
+
+// Midpoint circle, first octant: (x, y) from (0, r) while x <= y. Between
+// two steps of y, points a..b of the octant share row y: mirrored, that is a
+// horizontal run on the top and bottom arcs and a vertical run (rows a..b of
+// column y, a byte mask per page) on the sides. A disc fills the columns
+// between the arcs instead, as rectangles.
+static void circle_runs(gfx_surface_t *s, int cx, int cy, int a, int b, int y, int on, bool fill) {
+    const int w = b - a + 1;
+    if (fill) {
+        gfx_fill_rect(s, cx + a, cy - y, w, 2 * y + 1, on);
+        gfx_fill_rect(s, cx - b, cy - y, w, 2 * y + 1, on);
+        gfx_fill_rect(s, cx + y, cy - b, 1, 2 * b + 1, on);
+        gfx_fill_rect(s, cx - y, cy - b, 1, 2 * b + 1, on);
+        return;
+    }
+    hrun(s, cx + a, cx + b, cy - y, on);
+    hrun(s, cx - b, cx - a, cy - y, on);
+    hrun(s, cx + a, cx + b, cy + y, on);
+    hrun(s, cx - b, cx - a, cy + y, on);
+    vrun(s, cx + y, cy + a, cy + b, on);
+    vrun(s, cx + y, cy - b, cy - a, on);
+    vrun(s, cx - y, cy + a, cy + b, on);
+    vrun(s, cx - y, cy - b, cy - a, on);
+}
+
+static void circle(gfx_surface_t *s, int cx, int cy, int r, int on, bool fill) {
+    if (!s || !s->buf || r < 0) return;
+    if (cx + r < s->clip_x0 || cx - r > s->clip_x1 || cy + r < s->clip_y0 || cy - r > s->clip_y1) return;
+    int x = 0, y = r, err = 1 - r, a = 0;
+    while (x <= y) {
+        if (err < 0) {
+            err += 2 * x + 3;
+        } else {
+            circle_runs(s, cx, cy, a, x, y, on, fill);
+            a = x + 1;
+            err += 2 * (x - y) + 5;
+            --y;
+        }
+        ++x;
+    }
+    if (a < x) circle_runs(s, cx, cy, a, x - 1, y, on, fill);
+}
+
+void gfx_draw_circle(gfx_surface_t *s, int cx, int cy, int r, int on) {
+    circle(s, cx, cy, r, on, false);
+}
+
+void gfx_fill_circle(gfx_surface_t *s, int cx, int cy, int r, int on) {
+    circle(s, cx, cy, r, on, true);
+}
@@ -1,27 +1,163 @@
 // src/main.c
+#define _POSIX_C_SOURCE 200809L   // isatty
+#include "perf.h"
 #include "port.h"
 #include "ssd1306.h"
+#include "ssd1306_async.h"
+#include "ssd1306_capture.h"
+#include "ssd1306_state.h"
 #include "app_calc.h"
+#include "app_map.h"
+#include "app_term.h"
+#include "oled_client.h"
+#include "oled_server.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--batch | --interactive [--journal FILE] | --term] [--refresh-ms N] [--capture FILE [--capture-max KB]]\n"
+            "          [--warm] [--state FILE]\n"
+            "       %s --display [--region X,Y,W,H] [--batch | --interactive [--journal FILE]] [--refresh-ms N]\n"
+            "       %s --map EXPR [--raw] FILE\n"
+            "  --batch        read tokens from stdin without prompts (default when stdin is not a tty)\n"
+            "  --interactive  prompt for one token per line (default on a tty)\n"
+            "  --journal FILE keep the session in FILE: resume on start, 'undo'/'redo' tokens\n"
+            "  --term         tail stdin as a scrolling log console instead of the calculator\n"
+            "  --refresh-ms N in batch mode, redraw every N ms (default 0: only at end of input)\n"
+            "  --capture FILE append every frame sent to the panel to FILE (replay with oled_replay)\n"
+            "  --capture-max KB  rotate FILE to FILE.1 when it grows past KB kilobytes\n"
+            "  --state FILE   save the panel contents to FILE on exit\n"
+            "  --warm         attach to a panel an earlier run left configured: no init sequence,\n"
+            "                 and with --state the saved contents are not sent again\n"
+            "  --display      draw through the display server (oled_server) instead of opening the panel;\n"
+            "                 socket from $OLED_SERVER_SOCKET\n"
+            "  --region X,Y,W,H  with --display, the part of the panel to own; the calculator is laid out in it (default: all of it)\n"
+            "  --map EXPR     apply calculator ops (e.g. \"and 0xFF << 4 dec\") to every number in FILE\n"
+            "                 ('-' = stdin), results on stdout; no panel is used\n"
+            "  --raw          with --map: FILE and the output are packed 64-bit values\n",
+            argv0, argv0, argv0);
+}
+
+// Calculator on a display server surface: no port, no flush thread, every
+// submit goes to the server.
+static int run_display(const int region[4], int batch, uint32_t refresh_ms, calc_journal_t *journal) {
+    oled_client_t *client = NULL;
+    if (oled_client_open(&client, NULL, region[0], region[1], region[2], region[3]) != 0) {
+        fprintf(stderr, "no display server at %s\n", oled_server_socket_path(NULL));
+        return 1;
+    }
+    ssd1306_t *dev = oled_client_dev(client);
+    if (batch) app_run_calc_batch(dev, stdin, refresh_ms);
+    else       app_run_calc(dev, journal);
+    oled_client_close(client);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    int      batch = isatty(STDIN_FILENO) ? 0 : 1;
+    int      term = 0;
+    uint32_t refresh_ms = 0;
+    const char *capture = NULL;
+    size_t   capture_max = 0;
+    const char *journal_path = NULL;
+    const char *state_path = NULL;
+    bool     warm = false;
+    const char *map_expr = NULL, *map_file = NULL;
+    bool     map_raw = false;
+    bool     display = false;
+    int      region[4] = { 0, 0, 128, 64 };
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--batch") == 0) batch = 1;
+        else if (strcmp(argv[i], "--interactive") == 0) batch = 0;
+        else if (strcmp(argv[i], "--term") == 0) term = 1;
+        else if (strcmp(argv[i], "--refresh-ms") == 0 && i + 1 < argc) refresh_ms = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--journal") == 0 && i + 1 < argc) journal_path = argv[++i];
+        else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc) capture = argv[++i];
+        else if (strcmp(argv[i], "--capture-max") == 0 && i + 1 < argc) capture_max = (size_t)strtoul(argv[++i], NULL, 10) * 1024u;
+        else if (strcmp(argv[i], "--state") == 0 && i + 1 < argc) state_path = argv[++i];
+        else if (strcmp(argv[i], "--warm") == 0) warm = true;
+        else if (strcmp(argv[i], "--map") == 0 && i + 1 < argc) map_expr = argv[++i];
+        else if (strcmp(argv[i], "--raw") == 0) map_raw = true;
+        else if (strcmp(argv[i], "--display") == 0) display = true;
+        else if (strcmp(argv[i], "--region") == 0 && i + 1 < argc &&
+                 sscanf(argv[++i], "%d,%d,%d,%d", &region[0], &region[1], &region[2], &region[3]) == 4) {}
+        else if ((argv[i][0] != '-' || argv[i][1] == '\0') && !map_file) map_file = argv[i];
+        else { usage(argv[0]); return 64; }
+    }
+    if (!map_expr != !map_file) { usage(argv[0]); return 64; }
+    if (map_expr) return app_run_map(map_expr, map_file, map_raw);
+    // The server owns the bus: nothing that talks to the panel directly
+    if (display && (term || capture || warm || state_path)) { usage(argv[0]); return 64; }
+    // The journal follows an interactive session only (batch is the default off a tty)
+    if (journal_path && (batch || term)) { usage(argv[0]); return 64; }
+
+    PERF_INSTALL();     // before any thread starts: stats on SIGUSR1 and at exit
+
+    calc_journal_t *journal = NULL;
+    if (journal_path && calc_journal_open(&journal, journal_path, 0) != 0) {
+        fprintf(stderr, "cannot open journal %s\n", journal_path);
+        return 3;
+    }
+    if (display) {
+        const int rc = run_display(region, batch, refresh_ms, journal);
+        calc_journal_close(journal);
+        return rc;
+    }
 
-int main(void) {
     const port_display_cfg_t cfg = {
         .i2c_addr = 0x3C,  // change to 0x3D if your panel uses it
         .width    = 128,
-        .height   = 64
+        .height   = 64,
+        .i2c_bus  = 1      // /dev/i2c-1 on Raspberry Pi (i2c-dev port)
     };
 
-    if (port_init(&cfg) != 0) return 1;
+    port_t *port = NULL;
+    if (port_open(&cfg, &port) != 0) return 1;
 
+    // Warm attach with a saved frame: the panel keeps its picture and the
+    // first render sends only what changed. A missing state file means no
+    // earlier run to attach to, so the panel is configured from scratch.
+    static uint8_t last_frame[128 * SSD1306_MAX_PAGES];
+    const bool have_frame = warm && state_path &&
+                            ssd1306_state_load(state_path, cfg.width, cfg.height, last_frame) == 0;
     ssd1306_t dev = {0};
-    if (ssd1306_init(&dev) != 0) {
-        port_shutdown();
+    const int irc = (warm && (have_frame || !state_path)) ? ssd1306_init_warm(&dev, port, have_frame ? last_frame : NULL)
+                                                          : ssd1306_init(&dev, port);
+    if (irc != 0) {
+        port_close(port);
         return 2;
     }
 
-    // Run the calculator app (console-driven for now)
-    app_run_calc(&dev);
+    if (capture && ssd1306_capture_start(&dev, capture, capture_max) != 0) {
+        fprintf(stderr, "cannot record to %s\n", capture);
+        ssd1306_deinit(&dev);
+        port_close(port);
+        return 3;
+    }
+
+    if (term) {
+        // The console flushes synchronously: its scroll command must follow the data
+        app_run_term(&dev, STDIN_FILENO);
+    } else {
+        // Flush frames from a background thread so input never waits on the bus
+        ssd1306_async_start(&dev);
 
+        // Run the calculator app (console-driven for now)
+        if (batch) app_run_calc_batch(&dev, stdin, refresh_ms);
+        else       app_run_calc(&dev, journal);
+
+        ssd1306_async_stop(&dev);   // sends the last submitted frame
+    }
+    ssd1306_capture_stop(&dev);
+    if (state_path && ssd1306_state_save(&dev, state_path) != 0) fprintf(stderr, "cannot save panel state to %s\n", state_path);
     ssd1306_deinit(&dev);
-    port_shutdown();
+    port_close(port);
+    calc_journal_close(journal);
     return 0;
-}
\ No newline at end of file
+}
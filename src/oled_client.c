@@ -0,0 +1,119 @@
+// src/oled_client.c
+// Display server client: a drawing device backed by a shared surface (see oled_client.h).
+#define _GNU_SOURCE               // MSG_CMSG_CLOEXEC
+#include "oled_client.h"
+#include "oled_server.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+struct oled_client {
+    int        fd;
+    size_t     bytes;
+    ssd1306_t  dev;             // buffer = the shared surface
+};
+
+static void spans_clean(ssd1306_t *dev) {
+    memset(dev->dirty_x0, 0xFF, sizeof(dev->dirty_x0));
+    memset(dev->dirty_x1, 0x00, sizeof(dev->dirty_x1));
+}
+
+static int submit_hook(void *ctx, ssd1306_t *dev) {
+    (void)dev;
+    return oled_client_commit((oled_client_t *)ctx);
+}
+
+// Receive the welcome and the surface memfd. Returns the fd or -1.
+static int recv_welcome(int fd, oled_msg_welcome_t *w) {
+    struct iovec iov = { w, sizeof(*w) };
+    union { struct cmsghdr h; char buf[CMSG_SPACE(sizeof(int))]; } ctl;
+    struct msghdr msg = { .msg_iov = &iov, .msg_iovlen = 1, .msg_control = ctl.buf, .msg_controllen = sizeof(ctl.buf) };
+    if (recvmsg(fd, &msg, MSG_CMSG_CLOEXEC) != (ssize_t)sizeof(*w) || w->type != OLED_MSG_WELCOME) return -1;
+    const struct cmsghdr *cm = CMSG_FIRSTHDR(&msg);
+    if (!cm || cm->cmsg_level != SOL_SOCKET || cm->cmsg_type != SCM_RIGHTS || cm->cmsg_len != CMSG_LEN(sizeof(int))) return -1;
+    int memfd;
+    memcpy(&memfd, CMSG_DATA(cm), sizeof(int));
+    return memfd;
+}
+
+int oled_client_open(oled_client_t **out, const char *path, int x, int y, int w, int h) {
+    if (!out || w <= 0 || h <= 0) return -1;
+    *out = NULL;
+    path = oled_server_socket_path(path);
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    if (strlen(path) >= sizeof(addr.sun_path)) return -1;
+    strcpy(addr.sun_path, path);
+
+    const int fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -2;
+    const oled_msg_hello_t hello = { OLED_MSG_HELLO, 0, (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+    oled_msg_welcome_t wel;
+    int memfd = -1;
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+        send(fd, &hello, sizeof(hello), MSG_NOSIGNAL) != (ssize_t)sizeof(hello) ||
+        (memfd = recv_welcome(fd, &wel)) < 0) {
+        close(fd);
+        return -2;
+    }
+
+    oled_client_t *c = (oled_client_t *)calloc(1, sizeof(*c));
+    if (!c) { close(memfd); close(fd); return -3; }
+    c->fd = fd;
+    c->dev.width  = wel.width;
+    c->dev.height = wel.height;
+    c->dev.pages  = (uint8_t)(wel.height / 8);
+    c->bytes = (size_t)wel.width * c->dev.pages;
+    // A fixed-geometry build can only draw on a surface of its own size
+    void *map = MAP_FAILED;
+    if (wel.width && wel.width <= 128 && c->dev.pages && c->dev.pages <= SSD1306_MAX_PAGES &&
+        SSD1306_WIDTH(&c->dev) == wel.width && SSD1306_HEIGHT(&c->dev) == wel.height)
+        map = mmap(NULL, c->bytes, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    close(memfd);
+    if (map == MAP_FAILED) { close(fd); free(c); return -3; }
+
+    c->dev.buffer = (uint8_t *)map;
+    c->dev.synced = true;
+    c->dev.remote_submit = submit_hook;
+    c->dev.remote_ctx = c;
+    spans_clean(&c->dev);               // the surface starts blank, like the server's copy
+    ssd1306_bind_surface(&c->dev);
+    *out = c;
+    return 0;
+}
+
+ssd1306_t* oled_client_dev(oled_client_t *c) {
+    return c ? &c->dev : NULL;
+}
+
+int oled_client_commit(oled_client_t *c) {
+    if (!c) return -1;
+    oled_msg_damage_t d;
+    memset(&d, 0, sizeof(d));
+    d.type = OLED_MSG_DAMAGE;
+    bool any = false;
+    for (int p = 0; p < SSD1306_PAGES(&c->dev); ++p) {
+        d.x0[p] = c->dev.dirty_x0[p];
+        d.x1[p] = c->dev.dirty_x1[p];
+        any |= d.x0[p] <= d.x1[p];
+    }
+    for (int p = SSD1306_PAGES(&c->dev); p < SSD1306_MAX_PAGES; ++p) d.x0[p] = 0xFF;
+    if (!any) return 0;
+
+    uint8_t ack = 0;
+    if (send(c->fd, &d, sizeof(d), MSG_NOSIGNAL) != (ssize_t)sizeof(d) ||
+        recv(c->fd, &ack, 1, 0) != 1 || ack != OLED_MSG_ACK) return -2;
+    spans_clean(&c->dev);
+    c->dev.last_flush_bytes = 0;        // the server's flush, not ours
+    return 0;
+}
+
+void oled_client_close(oled_client_t *c) {
+    if (!c) return;
+    munmap(c->dev.buffer, c->bytes);
+    close(c->fd);
+    free(c);
+}
@@ -0,0 +1,269 @@
+// src/oled_server.c
+// Display server: composites client surfaces onto the panel (see oled_server.h).
+#define _GNU_SOURCE               // memfd_create
+#include "oled_server.h"
+#include "gfx.h"
+#include "ssd1306_async.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct {
+    int       fd;
+    gfx_surface_t surf;         // shared surface, the client's own coordinates
+    size_t    bytes;            // its mapping
+    int       ox, oy;           // panel position of the surface's (0, 0)
+    int       x0, x1;           // owned columns
+    uint8_t   mask[SSD1306_MAX_PAGES];  // owned rows of each page
+    uint8_t   placed[128 * SSD1306_MAX_PAGES];  // the surface moved to its panel position
+} client_t;
+
+typedef struct {
+    int       fd;
+    uint64_t  since_ms;         // accepted at (CLOCK_MONOTONIC)
+} pending_t;
+
+typedef struct {
+    ssd1306_t *dev;
+    int        n;               // clients[0..n): bottom to top
+    client_t   clients[OLED_SERVER_MAX_CLIENTS];
+} server_t;
+
+static uint64_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u;
+}
+
+const char* oled_server_socket_path(const char *path) {
+    if (path) return path;
+    const char *env = getenv("OLED_SERVER_SOCKET");
+    return (env && *env) ? env : OLED_SERVER_SOCKET;
+}
+
+// ---------- Compositing ----------
+// Rebuild columns [a, b] of page p from every client's placed surface, bottom to top.
+static void compose(server_t *s, int p, int a, int b) {
+    ssd1306_t *dev = s->dev;
+    const int W = SSD1306_WIDTH(dev);
+    uint8_t row[128] = {0};
+    for (int i = 0; i < s->n; ++i) {
+        const client_t *c = &s->clients[i];
+        const uint8_t m = c->mask[p];
+        const int lo = a > c->x0 ? a : c->x0, hi = b < c->x1 ? b : c->x1;
+        if (!m || lo > hi) continue;
+        const uint8_t *src = &c->placed[(size_t)p * W];
+        for (int x = lo; x <= hi; ++x) row[x] = (uint8_t)((row[x] & ~m) | (src[x] & m));
+    }
+    uint8_t *dst = &dev->buffer[(size_t)p * W];
+    while (a <= b && dst[a] == row[a]) ++a;
+    while (b >= a && dst[b] == row[b]) --b;
+    if (a > b) return;
+    memcpy(&dst[a], &row[a], (size_t)(b - a + 1));
+    ssd1306_mark_dirty_span(dev, p, a, b);
+}
+
+// Rebuild the rectangle client c owns (on attach and detach).
+static void compose_client(server_t *s, const client_t *c) {
+    for (int p = 0; p < SSD1306_PAGES(s->dev); ++p)
+        if (c->mask[p] && c->x0 <= c->x1) compose(s, p, c->x0, c->x1);
+}
+
+// ---------- Clients ----------
+static int send_welcome(const client_t *c, int fd, int memfd) {
+    const oled_msg_welcome_t w = { OLED_MSG_WELCOME, 0, c->surf.width, c->surf.height };
+    struct iovec iov = { (void *)&w, sizeof(w) };
+    union { struct cmsghdr h; char buf[CMSG_SPACE(sizeof(int))]; } ctl;
+    memset(&ctl, 0, sizeof(ctl));
+    struct msghdr msg = { .msg_iov = &iov, .msg_iovlen = 1, .msg_control = ctl.buf, .msg_controllen = sizeof(ctl.buf) };
+    struct cmsghdr *cm = CMSG_FIRSTHDR(&msg);
+    cm->cmsg_level = SOL_SOCKET;
+    cm->cmsg_type  = SCM_RIGHTS;
+    cm->cmsg_len   = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cm), &memfd, sizeof(int));
+    return sendmsg(fd, &msg, MSG_NOSIGNAL) == (ssize_t)sizeof(w) ? 0 : -1;
+}
+
+// Set up client 'fd' from its hello: surface, rectangle, welcome. Closes fd on failure.
+static void attach(server_t *s, int fd, const oled_msg_hello_t *h) {
+    const int W = SSD1306_WIDTH(s->dev), H = SSD1306_HEIGHT(s->dev);
+    // The surface covers the rectangle, rounded up to whole pages, at most the panel
+    if (h->w <= 0 || h->h <= 0) { close(fd); return; }
+    const int P = SSD1306_PAGES(s->dev);
+    const int sw = h->w < W ? h->w : W;
+    const int sp = (h->h + 7) / 8 < P ? (h->h + 7) / 8 : P;
+    const size_t bytes = (size_t)sw * (size_t)sp;
+
+    client_t *c = &s->clients[s->n];
+    memset(c, 0, sizeof(*c));
+    const int memfd = memfd_create("oled-surface", MFD_CLOEXEC);
+    uint8_t *surf = MAP_FAILED;
+    if (memfd >= 0 && ftruncate(memfd, (off_t)bytes) == 0)
+        surf = (uint8_t *)mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    if (surf != MAP_FAILED) gfx_surface_init(&c->surf, surf, sw, 8 * sp);
+    if (surf == MAP_FAILED || send_welcome(c, fd, memfd) < 0) {
+        if (surf != MAP_FAILED) munmap(surf, bytes);
+        if (memfd >= 0) close(memfd);
+        close(fd);
+        return;
+    }
+    close(memfd);                       // the mappings keep it alive
+    ++s->n;
+
+    c->fd = fd;
+    c->bytes = bytes;
+    c->ox = h->x;
+    c->oy = h->y;
+    const int x0 = h->x < 0 ? 0 : h->x, y0 = h->y < 0 ? 0 : h->y;
+    const int x1 = h->x + h->w > W ? W - 1 : h->x + h->w - 1;
+    const int y1 = h->y + h->h > H ? H - 1 : h->y + h->h - 1;
+    c->x0 = x0; c->x1 = x1;
+    for (int y = y0; y <= y1 && x0 <= x1; ++y) c->mask[y >> 3] |= (uint8_t)(1u << (y & 7));
+    compose_client(s, c);               // the new top layer starts blank
+}
+
+static void detach(server_t *s, int i) {
+    client_t gone = s->clients[i];
+    memmove(&s->clients[i], &s->clients[i + 1], (size_t)(s->n - i - 1) * sizeof(client_t));
+    --s->n;
+    close(gone.fd);
+    munmap(gone.surf.buf, gone.bytes);
+    compose_client(s, &gone);           // uncover what was below
+}
+
+// Handle one packet from attached client i. Returns false when it must go.
+static bool client_message(server_t *s, int i) {
+    client_t *c = &s->clients[i];
+    oled_msg_damage_t d;
+    const ssize_t n = recv(c->fd, &d, sizeof(d), 0);
+    if (n != (ssize_t)sizeof(d) || d.type != OLED_MSG_DAMAGE) return false;
+
+    // Move each damaged run of the surface to its panel position; a surface
+    // page straddles two panel pages unless the rectangle is page-aligned
+    uint8_t x0[SSD1306_MAX_PAGES], x1[SSD1306_MAX_PAGES];
+    memset(x0, 0xFF, sizeof(x0));
+    memset(x1, 0x00, sizeof(x1));
+    const int W = SSD1306_WIDTH(s->dev), P = SSD1306_PAGES(s->dev);
+    gfx_surface_t placed;
+    gfx_surface_init(&placed, c->placed, W, SSD1306_HEIGHT(s->dev));
+    for (int q = 0; q < c->surf.pages; ++q) {
+        if (d.x0[q] > d.x1[q] || d.x0[q] >= c->surf.width) continue;
+        const int sb = d.x1[q] < c->surf.width ? d.x1[q] : c->surf.width - 1;
+        gfx_copy(&placed, c->ox + d.x0[q], c->oy + 8 * q, &c->surf, d.x0[q], 8 * q, sb - d.x0[q] + 1, 8, GFX_ROP_COPY);
+
+        int a = c->ox + d.x0[q], b = c->ox + sb;
+        if (a < 0) a = 0;
+        if (b > W - 1) b = W - 1;
+        for (int y = c->oy + 8 * q; y <= c->oy + 8 * q + 7; y += 7) {
+            const int p = y >> 3;
+            if (y < 0 || p >= P || a > b) continue;
+            if (a < x0[p]) x0[p] = (uint8_t)a;
+            if (b > x1[p]) x1[p] = (uint8_t)b;
+        }
+    }
+    for (int p = 0; p < P; ++p) {
+        const int a = x0[p] > c->x0 ? x0[p] : c->x0;
+        const int b = x1[p] < c->x1 ? x1[p] : c->x1;
+        if (c->mask[p] && a <= b) compose(s, p, a, b);
+    }
+    // The damaged bytes are copied out: the client may draw its next frame
+    const uint8_t ack = OLED_MSG_ACK;
+    return send(c->fd, &ack, 1, MSG_NOSIGNAL) == 1;
+}
+
+// ---------- Main loop ----------
+int oled_server_run(ssd1306_t *dev, const char *path, volatile sig_atomic_t *stop) {
+    if (!dev || !dev->buffer || !stop) return -1;
+    path = oled_server_socket_path(path);
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    if (strlen(path) >= sizeof(addr.sun_path)) return -1;
+    strcpy(addr.sun_path, path);
+
+    const int lfd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (lfd < 0) return -2;
+    unlink(path);                       // a stale socket from a previous server
+    if (bind(lfd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(lfd, OLED_SERVER_MAX_CLIENTS) < 0) {
+        close(lfd);
+        return -2;
+    }
+
+    static server_t s;
+    memset(&s, 0, sizeof(s));
+    s.dev = dev;
+    ssd1306_clear(dev);
+    ssd1306_submit(dev);
+
+    // pending[]: accepted sockets that have not said hello yet; one that stays
+    // silent for OLED_SERVER_HELLO_MS is dropped so it cannot hold the slot
+    pending_t pending[OLED_SERVER_MAX_CLIENTS];
+    int npending = 0;
+    while (!*stop) {
+        struct pollfd pfd[1 + 2 * OLED_SERVER_MAX_CLIENTS];
+        int n = 0, timeout = -1;
+        const uint64_t now = now_ms();
+        pfd[n++] = (struct pollfd){ .fd = lfd, .events = POLLIN };
+        for (int i = 0; i < s.n; ++i) pfd[n++] = (struct pollfd){ .fd = s.clients[i].fd, .events = POLLIN };
+        for (int i = 0; i < npending; ++i) {
+            pfd[n++] = (struct pollfd){ .fd = pending[i].fd, .events = POLLIN };
+            const uint64_t age = now - pending[i].since_ms;
+            const int left = age >= OLED_SERVER_HELLO_MS ? 0 : (int)(OLED_SERVER_HELLO_MS - age);
+            if (timeout < 0 || left < timeout) timeout = left;
+        }
+        if (poll(pfd, (nfds_t)n, timeout) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        // Attached clients, top first so a detach leaves lower indices valid
+        const int polled = s.n;
+        bool changed = false;
+        for (int i = polled - 1; i >= 0; --i) {
+            if (!pfd[1 + i].revents) continue;
+            if (!client_message(&s, i)) detach(&s, i);
+            changed = true;
+        }
+        // Hellos; the swap-remove only moves entries already looked at
+        for (int i = npending - 1; i >= 0; --i) {
+            if (!pfd[1 + polled + i].revents) continue;
+            oled_msg_hello_t h;
+            const int fd = pending[i].fd;
+            pending[i] = pending[--npending];
+            if (recv(fd, &h, sizeof(h), 0) != (ssize_t)sizeof(h) || h.type != OLED_MSG_HELLO || s.n == OLED_SERVER_MAX_CLIENTS) {
+                close(fd);
+                continue;
+            }
+            attach(&s, fd, &h);
+            changed = true;
+        }
+        const uint64_t later = now_ms();
+        for (int i = npending - 1; i >= 0; --i) {
+            if (later - pending[i].since_ms < OLED_SERVER_HELLO_MS) continue;
+            close(pending[i].fd);
+            pending[i] = pending[--npending];
+        }
+        if (pfd[0].revents & POLLIN) {
+            const int fd = accept4(lfd, NULL, NULL, SOCK_CLOEXEC);
+            if (fd >= 0 && npending < OLED_SERVER_MAX_CLIENTS) pending[npending++] = (pending_t){ fd, later };
+            else if (fd >= 0) close(fd);
+        }
+        if (changed) ssd1306_submit(dev);
+    }
+
+    // The panel keeps the last composited picture (for --state and a warm restart)
+    for (int i = 0; i < s.n; ++i) {
+        close(s.clients[i].fd);
+        munmap(s.clients[i].surf.buf, s.clients[i].bytes);
+    }
+    for (int i = 0; i < npending; ++i) close(pending[i].fd);
+    close(lfd);
+    unlink(path);
+    return 0;
+}
@@ -0,0 +1,188 @@
+// src/perf.c
+// Performance counters and the input-to-panel latency histogram (see perf.h).
+// Empty unless built with OLED_PERF=1.
+#define _POSIX_C_SOURCE 200809L   // clock_gettime, sigwait, pthread_sigmask
+#include "perf.h"
+
+#if OLED_PERF
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct {
+    atomic_uint_fast64_t calls, errors, retries, bytes, total_ns, max_ns;
+} probe_t;
+
+static probe_t              s_probe[PERF_NPROBES];
+static const char *const    s_probe_name[PERF_NPROBES] = {
+    "port_cmd", "port_data", "update_full", "update_dirty", "render_calc",
+};
+
+static atomic_uint_fast64_t s_main_ns, s_first_frame_ns;    // startup: perf_install, first flush
+static int64_t              s_exec_to_main_us = -1;         // -1: unknown (no /proc)
+static atomic_uint_fast64_t s_input_ns;                 // oldest input not on the panel; 0 = none
+static atomic_uint_fast64_t s_hist[PERF_HIST_BUCKETS];
+static atomic_uint_fast64_t s_hist_count, s_hist_sum_us, s_hist_max_us;
+
+uint64_t perf_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void store_max(atomic_uint_fast64_t *m, uint64_t v) {
+    uint_fast64_t cur = atomic_load_explicit(m, memory_order_relaxed);
+    while (v > cur && !atomic_compare_exchange_weak_explicit(m, &cur, v, memory_order_relaxed, memory_order_relaxed)) { }
+}
+
+void perf_record(perf_probe_t probe, uint64_t t0_ns, size_t bytes, int rc) {
+    probe_t *p = &s_probe[probe];
+    const uint64_t ns = perf_now_ns() - t0_ns;
+    atomic_fetch_add_explicit(&p->calls, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&p->total_ns, ns, memory_order_relaxed);
+    store_max(&p->max_ns, ns);
+    if (rc < 0) atomic_fetch_add_explicit(&p->errors, 1, memory_order_relaxed);
+    else        atomic_fetch_add_explicit(&p->bytes, bytes, memory_order_relaxed);
+}
+
+void perf_retry(perf_probe_t probe) {
+    atomic_fetch_add_explicit(&s_probe[probe].retries, 1, memory_order_relaxed);
+}
+
+void perf_input(void) {
+    uint_fast64_t none = 0;
+    atomic_compare_exchange_strong(&s_input_ns, &none, perf_now_ns());
+}
+
+void perf_input_idle(void) {
+    atomic_store(&s_input_ns, 0);
+}
+
+void perf_frame_on_panel(void) {
+    if (!atomic_load_explicit(&s_first_frame_ns, memory_order_relaxed)) {
+        uint_fast64_t none = 0;
+        atomic_compare_exchange_strong(&s_first_frame_ns, &none, perf_now_ns());
+    }
+    const uint64_t t0 = atomic_exchange(&s_input_ns, 0);
+    if (!t0) return;
+    const uint64_t us = (perf_now_ns() - t0) / 1000u;
+    int b = 0;
+    while (b < PERF_HIST_BUCKETS - 1 && (us >> (b + 1))) ++b;
+    atomic_fetch_add_explicit(&s_hist[b], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&s_hist_count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&s_hist_sum_us, us, memory_order_relaxed);
+    store_max(&s_hist_max_us, us);
+}
+
+// Upper edge (us) of the bucket holding the q-quantile.
+static uint64_t hist_quantile(const uint64_t *h, uint64_t count, double q) {
+    const uint64_t want = (uint64_t)((double)count * q + 0.5);
+    uint64_t seen = 0;
+    for (int b = 0; b < PERF_HIST_BUCKETS; ++b) {
+        seen += h[b];
+        if (seen >= want && seen) return (2ull << b) - 1u;
+    }
+    return 0;
+}
+
+void perf_dump(FILE *out) {
+    if (!out) return;
+    for (int i = 0; i < PERF_NPROBES; ++i) {
+        const probe_t *p = &s_probe[i];
+        const uint64_t calls = atomic_load(&p->calls), total = atomic_load(&p->total_ns);
+        fprintf(out, "{\"probe\":\"%s\",\"calls\":%llu,\"errors\":%llu,\"retries\":%llu,\"bytes\":%llu,"
+                     "\"total_us\":%.1f,\"avg_ns\":%.0f,\"max_ns\":%llu}\n",
+                s_probe_name[i], (unsigned long long)calls, (unsigned long long)atomic_load(&p->errors),
+                (unsigned long long)atomic_load(&p->retries), (unsigned long long)atomic_load(&p->bytes),
+                (double)total / 1000.0, calls ? (double)total / (double)calls : 0.0,
+                (unsigned long long)atomic_load(&p->max_ns));
+    }
+
+    uint64_t h[PERF_HIST_BUCKETS];
+    for (int b = 0; b < PERF_HIST_BUCKETS; ++b) h[b] = atomic_load(&s_hist[b]);
+    const uint64_t count = atomic_load(&s_hist_count);
+    fprintf(out, "{\"histogram\":\"input_to_panel_us\",\"count\":%llu,\"avg\":%.0f,\"max\":%llu,"
+                 "\"p50\":%llu,\"p90\":%llu,\"p99\":%llu,\"buckets\":[",
+            (unsigned long long)count, count ? (double)atomic_load(&s_hist_sum_us) / (double)count : 0.0,
+            (unsigned long long)atomic_load(&s_hist_max_us),
+            (unsigned long long)hist_quantile(h, count, 0.50), (unsigned long long)hist_quantile(h, count, 0.90),
+            (unsigned long long)hist_quantile(h, count, 0.99));
+    // Trailing empty buckets are left out; bucket i spans [2^i, 2^(i+1)) us
+    int last = PERF_HIST_BUCKETS - 1;
+    while (last > 0 && !h[last]) --last;
+    for (int b = 0; b <= last; ++b) fprintf(out, "%s%llu", b ? "," : "", (unsigned long long)h[b]);
+    fprintf(out, "]}\n");
+
+    const uint64_t t_main = atomic_load(&s_main_ns), t_first = atomic_load(&s_first_frame_ns);
+    if (t_main && t_first) {
+        const int64_t main_us = (int64_t)((t_first - t_main) / 1000u);
+        fprintf(out, "{\"startup\":\"exec_to_first_frame_us\",\"exec_to_main_us\":%lld,"
+                     "\"main_to_first_frame_us\":%lld,\"total_us\":%lld}\n",
+                (long long)s_exec_to_main_us, (long long)main_us,
+                (long long)(s_exec_to_main_us < 0 ? -1 : s_exec_to_main_us + main_us));
+    }
+    fflush(out);
+}
+
+// ---------- Startup ----------
+// Time since exec: the process start time from /proc/self/stat (clock ticks
+// since boot, so 1/CLK_TCK resolution, usually 10 ms) against CLOCK_BOOTTIME.
+static int64_t since_exec_us(void) {
+    FILE *f = fopen("/proc/self/stat", "r");
+    if (!f) return -1;
+    char buf[1024];
+    const size_t n = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[n] = '\0';
+    const char *p = strrchr(buf, ')');     // the command name may hold spaces
+    unsigned long long start = 0;
+    // Fields after the name: state ppid ... starttime is the 20th
+    if (!p || sscanf(p + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %*u %*u %*d %*d %*d %*d %*d %*d %llu",
+                     &start) != 1) return -1;
+    struct timespec ts;
+    if (clock_gettime(CLOCK_BOOTTIME, &ts) != 0) return -1;
+    const long tck = sysconf(_SC_CLK_TCK);
+    const int64_t now_us = (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+    const int64_t start_us = (int64_t)(start * 1000000ull / (unsigned long long)(tck > 0 ? tck : 100));
+    return now_us >= start_us ? now_us - start_us : -1;
+}
+
+// ---------- Export ----------
+static void dump_to_target(void) {
+    const char *path = getenv("OLED_PERF_OUT");
+    FILE *out = path ? fopen(path, "a") : stderr;
+    if (!out) return;
+    perf_dump(out);
+    if (out != stderr) fclose(out);
+}
+
+static void *signal_main(void *arg) {
+    const sigset_t *set = (const sigset_t *)arg;
+    for (;;) {
+        int sig;
+        if (sigwait(set, &sig) == 0) dump_to_target();
+    }
+    return NULL;
+}
+
+void perf_install(void) {
+    atomic_store(&s_main_ns, perf_now_ns());
+    s_exec_to_main_us = since_exec_us();
+
+    static sigset_t set;
+    static pthread_t thread;
+    sigemptyset(&set);
+    sigaddset(&set, SIGUSR1);
+    if (pthread_sigmask(SIG_BLOCK, &set, NULL) == 0 &&
+        pthread_create(&thread, NULL, signal_main, &set) == 0) {
+        pthread_detach(thread);
+    }
+    atexit(dump_to_target);
+}
+#else
+typedef int perf_disabled_t;    // ISO C wants a non-empty translation unit
+#endif
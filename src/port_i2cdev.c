@@ -0,0 +1,175 @@
+// src/port_i2cdev.c
+// Linux port talking straight to /dev/i2c-N with ioctl(I2C_RDWR); no WiringPi needed.
+// Data is sent zero-copy: the 0x40 control byte is parked in the byte just before
+// each run (see port_write_window), so a whole frame is a single I2C message.
+
+#define _POSIX_C_SOURCE 200809L   // nanosleep
+#include "port.h"
+#include "perf.h"
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <sys/ioctl.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef PORT_I2CDEV_MAX_MSG
+#define PORT_I2CDEV_MAX_MSG  8192   // i2c-dev refuses longer messages
+#endif
+
+#ifndef PORT_I2CDEV_BOUNCE
+#define PORT_I2CDEV_BOUNCE   1024   // bounce buffer for the copying (const) paths
+#endif
+
+#ifndef PORT_I2CDEV_RETRIES
+#define PORT_I2CDEV_RETRIES  2      // extra attempts for a command transfer that failed
+#endif
+
+#define CTRL_CMD   0x00
+#define CTRL_DATA  0x40
+
+// Each panel has its own descriptor on its bus; the kernel serialises
+// transfers from several descriptors on one adapter.
+struct port {
+    int                 fd;         // /dev/i2c-N file descriptor
+    port_display_cfg_t  cfg;        // active config
+    uint8_t             bounce[1 + PORT_I2CDEV_BOUNCE];
+};
+
+int port_open(const port_display_cfg_t *cfg, port_t **out) {
+    if (!cfg || !out) return -1;
+    *out = NULL;
+
+    port_t *p = (port_t *)calloc(1, sizeof(*p));
+    if (!p) return -4;
+    p->cfg = *cfg;
+
+    char path[32];
+    snprintf(path, sizeof(path), "/dev/i2c-%u", (unsigned)p->cfg.i2c_bus);
+    p->fd = open(path, O_RDWR);
+    if (p->fd < 0) {
+        fprintf(stderr, "open %s failed: %s\n", path, strerror(errno));
+        free(p);
+        return -2;
+    }
+    unsigned long funcs = 0;
+    if (ioctl(p->fd, I2C_FUNCS, &funcs) < 0 || !(funcs & I2C_FUNC_I2C)) {
+        fprintf(stderr, "%s: adapter does not support plain I2C transfers\n", path);
+        close(p->fd);
+        free(p);
+        return -3;
+    }
+    *out = p;
+    return 0;
+}
+
+void port_close(port_t *port) {
+    if (!port) return;
+    if (port->fd >= 0) close(port->fd);
+    free(port);
+}
+
+void port_delay_ms(uint32_t ms) {
+    struct timespec ts = { (time_t)(ms / 1000u), (long)(ms % 1000u) * 1000000L };
+    while (nanosleep(&ts, &ts) < 0 && errno == EINTR) { }
+}
+
+// Issue one combined transfer (repeated START between messages, one STOP).
+// Command transfers are retried after a NAK or bus timeout: they only set
+// registers, so resending is harmless. Data is not, since the panel's RAM
+// pointer has moved; that error goes to the driver.
+static int xfer(port_t *port, struct i2c_msg *msgs, size_t n) {
+    if (n == 0) return 0;
+    struct i2c_rdwr_ioctl_data rdwr = { .msgs = msgs, .nmsgs = (uint32_t)n };
+    const bool cmd = msgs[0].buf[0] == CTRL_CMD;
+    for (int attempt = 0;; ++attempt) {
+        if (ioctl(port->fd, I2C_RDWR, &rdwr) >= 0) return 0;
+        const bool transient = errno == EREMOTEIO || errno == ENXIO || errno == EAGAIN || errno == ETIMEDOUT;
+        if (!cmd || !transient || attempt == PORT_I2CDEV_RETRIES) return -1;
+        PERF_RETRY(PERF_PORT_CMD);
+    }
+}
+
+// Copying path: [ctrl, bytes...] through the bounce buffer.
+static int write_copied(port_t *port, uint8_t ctrl, const uint8_t *bytes, size_t len) {
+    uint8_t *bounce = port->bounce;
+    size_t written = 0;
+    bounce[0] = ctrl;
+    while (written < len) {
+        size_t chunk = len - written;
+        if (chunk > PORT_I2CDEV_BOUNCE) chunk = PORT_I2CDEV_BOUNCE;
+        memcpy(&bounce[1], &bytes[written], chunk);
+        struct i2c_msg m = { .addr = port->cfg.i2c_addr, .flags = 0,
+                             .len = (uint16_t)(1 + chunk), .buf = bounce };
+        if (xfer(port, &m, 1) < 0) return -1;
+        written += chunk;
+    }
+    return 0;
+}
+
+int port_write_cmd(port_t *port, uint8_t cmd) {
+    uint8_t buf[2] = { CTRL_CMD, cmd };
+    struct i2c_msg m = { .addr = port->cfg.i2c_addr, .flags = 0, .len = 2, .buf = buf };
+    return xfer(port, &m, 1);
+}
+
+int port_write_cmds(port_t *port, const uint8_t *cmds, size_t n) {
+    if (!cmds || n == 0) return 0;
+    return write_copied(port, CTRL_CMD, cmds, n);
+}
+
+int port_write_data(port_t *port, const uint8_t *data, size_t len) {
+    if (!data || len == 0) return 0;
+    return write_copied(port, CTRL_DATA, data, len);
+}
+
+int port_write_window(port_t *port, uint8_t *data, size_t span, size_t stride, size_t rows) {
+    if (!data) return -1;
+    if (span == 0 || rows == 0) return 0;
+    if (stride == span) { span *= rows; rows = 1; }   // contiguous: one run
+
+    const size_t max_payload = PORT_I2CDEV_MAX_MSG - 1;
+    struct i2c_msg msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+    uint8_t        saved[I2C_RDWR_IOCTL_MAX_MSGS];
+    size_t         n = 0;
+    const uint8_t *batch_end = NULL;  // one past the last pending payload byte
+    int rc = 0;
+
+    for (size_t r = 0; r < rows && rc == 0; ++r) {
+        uint8_t *run = &data[r * stride];
+        for (size_t off = 0; off < span && rc == 0; ) {
+            size_t chunk = span - off;
+            if (chunk > max_payload) chunk = max_payload;
+            uint8_t *slot = &run[off] - 1;
+
+            // A slot inside the previous message's payload (a split run) or a
+            // full message table forces the pending batch out first.
+            if (n == I2C_RDWR_IOCTL_MAX_MSGS || (n && slot < batch_end)) {
+                rc = xfer(port, msgs, n);
+                while (n) { --n; msgs[n].buf[0] = saved[n]; }
+                if (rc < 0) break;
+            }
+            saved[n] = *slot;
+            *slot = CTRL_DATA;
+            msgs[n] = (struct i2c_msg){ .addr = port->cfg.i2c_addr, .flags = 0,
+                                        .len = (uint16_t)(1 + chunk), .buf = slot };
+            ++n;
+            off += chunk;
+            batch_end = &run[off];
+        }
+    }
+    if (rc == 0) rc = xfer(port, msgs, n);
+    while (n) { --n; msgs[n].buf[0] = saved[n]; }   // hand the slots back
+    return rc;
+}
+
+size_t port_max_xfer(const port_t *port) { (void)port; return PORT_I2CDEV_BOUNCE; }
+
+const port_display_cfg_t* port_get_cfg(const port_t *port) {
+    return port ? &port->cfg : NULL;
+}
@@ -0,0 +1,272 @@
+// src/port_sim.c
+// Simulated port: decodes the SSD1306 command stream into an emulated panel and
+// counts bus traffic. Lets the driver, gfx and apps run (and be timed) on any host.
+
+#define _POSIX_C_SOURCE 200809L   // clock_nanosleep
+#include "port.h"
+#include "port_sim.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef PORT_SIM_MAX_XFER
+#define PORT_SIM_MAX_XFER  1024   // payload bytes per transaction, like the i2c-dev port
+#endif
+
+struct port {
+    port_display_cfg_t  cfg;        // active config
+    port_sim_panel_t    panel;      // emulated controller
+    port_sim_stats_t    stats;
+
+    // Command decoder: opcode awaiting 'need' more argument bytes.
+    uint8_t op, need, argc;
+    uint8_t args[6];
+};
+
+// ---------- Bus timing ----------
+// With a bus clock set, every transaction holds its bus for the time it would
+// take on the wire, so panels sharing a bus serialise and separate buses run
+// in parallel, like the real thing.
+static uint32_t         s_bus_hz;
+static pthread_once_t   s_bus_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t  s_bus_lock[PORT_SIM_BUSES];
+static struct timespec  s_bus_free[PORT_SIM_BUSES];    // when the wire goes idle
+
+static void bus_setup(void) {
+    for (int i = 0; i < PORT_SIM_BUSES; ++i) pthread_mutex_init(&s_bus_lock[i], NULL);
+    const char *hz = getenv("OLED_SIM_BUS_HZ");
+    if (hz && !s_bus_hz) s_bus_hz = (uint32_t)strtoul(hz, NULL, 10);
+}
+
+void port_sim_set_bus_clock(uint32_t hz) {
+    pthread_once(&s_bus_once, bus_setup);
+    s_bus_hz = hz;
+}
+
+// Occupy the bus for one transaction of 'payload' bytes (address + control added).
+static void bus_hold(uint8_t bus, size_t payload) {
+    if (!s_bus_hz) return;
+    const uint64_t ns = ((uint64_t)(2 + payload) * 9u + 2u) * 1000000000ull / s_bus_hz;
+    struct timespec now, *free_at = &s_bus_free[bus % PORT_SIM_BUSES];
+
+    pthread_mutex_lock(&s_bus_lock[bus % PORT_SIM_BUSES]);
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (free_at->tv_sec < now.tv_sec || (free_at->tv_sec == now.tv_sec && free_at->tv_nsec < now.tv_nsec))
+        *free_at = now;
+    const uint64_t end = (uint64_t)free_at->tv_nsec + ns;
+    free_at->tv_sec += (time_t)(end / 1000000000ull);
+    free_at->tv_nsec = (long)(end % 1000000000ull);
+    // Absolute deadline: sleep overheads do not accumulate across transactions
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, free_at, NULL) == EINTR) { }
+    pthread_mutex_unlock(&s_bus_lock[bus % PORT_SIM_BUSES]);
+}
+
+int port_open(const port_display_cfg_t *cfg, port_t **out) {
+    if (!cfg || !out) return -1;
+    pthread_once(&s_bus_once, bus_setup);
+
+    port_t *p = (port_t *)calloc(1, sizeof(*p));
+    if (!p) return -4;
+    p->cfg = *cfg;
+    p->panel.addr_mode  = 2;                 // SSD1306 reset state: page addressing
+    p->panel.col_end    = PORT_SIM_COLS - 1;
+    p->panel.page_end   = PORT_SIM_PAGES - 1;
+    p->panel.contrast   = 0x7F;
+    *out = p;
+    return 0;
+}
+
+void port_close(port_t *port) {
+    if (!port) return;
+    if (getenv("OLED_SIM_REPORT")) port_sim_report(port, stderr);
+    free(port);
+}
+
+void port_sim_report(const port_t *port, FILE *out) {
+    if (!port || !out) return;
+    const port_sim_stats_t *st = &port->stats;
+    fprintf(out, "sim: panel 0x%02X on bus %u\n", port->cfg.i2c_addr, (unsigned)port->cfg.i2c_bus);
+    fprintf(out,
+            "sim: transactions=%llu cmd_bytes=%llu data_bytes=%llu wire_bytes=%llu\n"
+            "sim: bus time 100kHz=%.0fus 400kHz=%.0fus 1MHz=%.0fus\n",
+            (unsigned long long)st->transactions, (unsigned long long)st->cmd_bytes,
+            (unsigned long long)st->data_bytes, (unsigned long long)port_sim_wire_bytes(st),
+            port_sim_bus_time_us(st, 100000), port_sim_bus_time_us(st, 400000),
+            port_sim_bus_time_us(st, 1000000));
+    port_sim_dump_ascii(port, out, port->cfg.width, (uint8_t)(port->cfg.height / 8));
+}
+
+void port_delay_ms(uint32_t ms) { (void)ms; }   // the simulator does not sleep
+
+// ---------- Controller emulation ----------
+static uint8_t cmd_arg_count(uint8_t op) {
+    switch (op) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+        case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x29: case 0x2A:
+            return 5;
+        case 0x26: case 0x27:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+static void cmd_exec(port_sim_panel_t *p, uint8_t op, const uint8_t *a) {
+    if (op <= 0x0F)                { p->col = (uint8_t)((p->col & 0xF0) | op); return; }
+    if (op <= 0x1F)                { p->col = (uint8_t)((p->col & 0x0F) | ((op & 0x0F) << 4)); return; }
+    if (op >= 0x40 && op <= 0x7F)  { p->start_line = (uint8_t)(op - 0x40); return; }
+    if (op >= 0xB0 && op <= 0xB7)  { p->page = (uint8_t)(op - 0xB0); return; }
+    switch (op) {
+        case 0x20: p->addr_mode = (uint8_t)(a[0] & 3); break;
+        case 0x21:
+            p->col_start = (uint8_t)(a[0] & 0x7F); p->col_end = (uint8_t)(a[1] & 0x7F);
+            p->col = p->col_start;
+            break;
+        case 0x22:
+            p->page_start = (uint8_t)(a[0] & 7); p->page_end = (uint8_t)(a[1] & 7);
+            p->page = p->page_start;
+            break;
+        case 0x81: p->contrast = a[0]; break;
+        case 0xA6: p->inverted = false; break;
+        case 0xA7: p->inverted = true;  break;
+        case 0xAE: p->display_on = false; break;
+        case 0xAF: p->display_on = true;  break;
+        default: break;   // timing/hardware config: accepted, not modelled
+    }
+}
+
+static void cmd_byte(port_t *port, uint8_t b) {
+    if (port->need) {
+        port->args[port->argc++] = b;
+        if (--port->need == 0) cmd_exec(&port->panel, port->op, port->args);
+        return;
+    }
+    port->op = b; port->argc = 0;
+    port->need = cmd_arg_count(b);
+    if (!port->need) cmd_exec(&port->panel, b, port->args);
+}
+
+static void data_byte(port_sim_panel_t *p, uint8_t b) {
+    p->gddram[p->page & 7][p->col & 0x7F] = b;
+    switch (p->addr_mode) {
+        case 0:     // horizontal: column first, then page
+            if (p->col >= p->col_end) {
+                p->col = p->col_start;
+                p->page = (p->page >= p->page_end) ? p->page_start : (uint8_t)(p->page + 1);
+            } else ++p->col;
+            break;
+        case 1:     // vertical: page first, then column
+            if (p->page >= p->page_end) {
+                p->page = p->page_start;
+                p->col = (p->col >= p->col_end) ? p->col_start : (uint8_t)(p->col + 1);
+            } else ++p->page;
+            break;
+        default:    // page: column wraps inside the current page
+            p->col = (p->col >= PORT_SIM_COLS - 1) ? 0 : (uint8_t)(p->col + 1);
+            break;
+    }
+}
+
+// One bus transaction: [ctrl, payload...]
+static void transaction(port_t *port, uint8_t ctrl, const uint8_t *bytes, size_t n) {
+    port->stats.transactions++;
+    port->stats.ctrl_bytes++;
+    if (ctrl == 0x40) {
+        port->stats.data_bytes += n;
+        for (size_t i = 0; i < n; ++i) data_byte(&port->panel, bytes[i]);
+    } else {
+        port->stats.cmd_bytes += n;
+        for (size_t i = 0; i < n; ++i) cmd_byte(port, bytes[i]);
+    }
+    bus_hold(port->cfg.i2c_bus, n);
+}
+
+static void chunked(port_t *port, uint8_t ctrl, const uint8_t *bytes, size_t n) {
+    while (n) {
+        size_t chunk = n > PORT_SIM_MAX_XFER ? PORT_SIM_MAX_XFER : n;
+        transaction(port, ctrl, bytes, chunk);
+        bytes += chunk; n -= chunk;
+    }
+}
+
+// ---------- Port API ----------
+int port_write_cmd(port_t *port, uint8_t cmd) {
+    transaction(port, 0x00, &cmd, 1);
+    return 0;
+}
+
+int port_write_cmds(port_t *port, const uint8_t *cmds, size_t n) {
+    if (!cmds || n == 0) return 0;
+    chunked(port, 0x00, cmds, n);
+    return 0;
+}
+
+int port_write_data(port_t *port, const uint8_t *data, size_t len) {
+    if (!data || len == 0) return 0;
+    chunked(port, 0x40, data, len);
+    return 0;
+}
+
+int port_write_window(port_t *port, uint8_t *data, size_t span, size_t stride, size_t rows) {
+    if (!data) return -1;
+    if (stride == span) { span *= rows; rows = 1; }   // contiguous: one run
+    for (size_t r = 0; r < rows; ++r) chunked(port, 0x40, &data[r * stride], span);
+    return 0;
+}
+
+size_t port_max_xfer(const port_t *port) { (void)port; return PORT_SIM_MAX_XFER; }
+
+const port_display_cfg_t* port_get_cfg(const port_t *port) {
+    return port ? &port->cfg : NULL;
+}
+
+// ---------- Simulator API ----------
+const port_sim_panel_t* port_sim_panel(const port_t *port) { return &port->panel; }
+
+const port_sim_stats_t* port_sim_stats(const port_t *port) { return &port->stats; }
+
+void port_sim_reset_stats(port_t *port) { memset(&port->stats, 0, sizeof(port->stats)); }
+
+uint64_t port_sim_wire_bytes(const port_sim_stats_t *st) {
+    if (!st) return 0;
+    // address byte per transaction + control bytes + payload
+    return st->transactions + st->ctrl_bytes + st->cmd_bytes + st->data_bytes;
+}
+
+double port_sim_bus_time_us(const port_sim_stats_t *st, uint32_t hz) {
+    if (!st || hz == 0) return 0.0;
+    // 9 clocks per byte (8 data + ACK), ~2 clocks per transaction for START/STOP
+    const double clocks = (double)port_sim_wire_bytes(st) * 9.0 + (double)st->transactions * 2.0;
+    return clocks * 1e6 / (double)hz;
+}
+
+long port_sim_compare(const port_t *port, const uint8_t *fb, uint16_t width, uint8_t pages) {
+    if (!fb || width > PORT_SIM_COLS || pages > PORT_SIM_PAGES) return 0;
+    for (uint8_t p = 0; p < pages; ++p) {
+        for (uint16_t x = 0; x < width; ++x) {
+            if (port->panel.gddram[p][x] != fb[(size_t)p * width + x]) return (long)p * width + x;
+        }
+    }
+    return -1;
+}
+
+void port_sim_dump_ascii(const port_t *port, FILE *out, uint16_t width, uint8_t pages) {
+    if (!port || !out) return;
+    const port_sim_panel_t *panel = &port->panel;
+    if (width > PORT_SIM_COLS) width = PORT_SIM_COLS;
+    if (pages > PORT_SIM_PAGES) pages = PORT_SIM_PAGES;
+    // Rows as seen on the glass: display row y shows RAM row (y + start line)
+    for (int y = 0; y < pages * 8; ++y) {
+        const int ry = (y + panel->start_line) % (pages * 8);
+        for (int x = 0; x < width; ++x) {
+            fputc(((panel->gddram[ry >> 3][x] >> (ry & 7)) & 1) ? '#' : '.', out);
+        }
+        fputc('\n', out);
+    }
+}
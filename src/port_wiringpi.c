@@ -7,43 +7,87 @@
 #include <unistd.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
 
 #ifndef PORT_I2C_CHUNK
 #define PORT_I2C_CHUNK  16   // bytes per I2C write burst (plus 1 control byte)
 #endif
 
-static int                 s_fd   = -1;      // I2C file descriptor
-static port_display_cfg_t  s_cfg;            // active config
+#ifndef PORT_I2C_MAX_XFER
+#define PORT_I2C_MAX_XFER  32  // max bytes per command transaction (plus 1 control byte)
+#endif
+
+struct port {
+    int                 fd;         // I2C file descriptor
+    port_display_cfg_t  cfg;        // active config
+};
+
+static bool s_setup_done;           // wiringPiSetup() is process-wide
 
-int port_init(const port_display_cfg_t *cfg) {
-    if (!cfg) return -1;
-    s_cfg = *cfg;
+int port_open(const port_display_cfg_t *cfg, port_t **out) {
+    if (!cfg || !out) return -1;
+    *out = NULL;
 
-    if (wiringPiSetup() == -1) {
-        fprintf(stderr, "wiringPiSetup failed\n");
-        return -2;
+    if (!s_setup_done) {
+        if (wiringPiSetup() == -1) {
+            fprintf(stderr, "wiringPiSetup failed\n");
+            return -2;
+        }
+        s_setup_done = true;
     }
-    s_fd = wiringPiI2CSetup(s_cfg.i2c_addr);
-    if (s_fd < 0) {
-        fprintf(stderr, "I2C open failed (addr 0x%02X)\n", s_cfg.i2c_addr);
+
+    port_t *p = (port_t *)calloc(1, sizeof(*p));
+    if (!p) return -4;
+    p->cfg = *cfg;
+
+    char path[32];
+    snprintf(path, sizeof(path), "/dev/i2c-%u", (unsigned)p->cfg.i2c_bus);
+    p->fd = wiringPiI2CSetupInterface(path, p->cfg.i2c_addr);
+    if (p->fd < 0) {
+        fprintf(stderr, "I2C open failed (%s addr 0x%02X)\n", path, p->cfg.i2c_addr);
+        free(p);
         return -3;
     }
+    *out = p;
     return 0;
 }
 
-void port_shutdown(void) {
-    // Nothing specific for WiringPi; left for symmetry / other ports.
+void port_close(port_t *port) {
+    if (!port) return;
+    if (port->fd >= 0) close(port->fd);
+    free(port);
 }
 
 void port_delay_ms(uint32_t ms) { delay(ms); }
 
-int port_write_cmd(uint8_t cmd) {
+int port_write_cmd(port_t *port, uint8_t cmd) {
     // Control byte 0x00 indicates "command"
-    int rc = wiringPiI2CWriteReg8(s_fd, 0x00, cmd);
+    int rc = wiringPiI2CWriteReg8(port->fd, 0x00, cmd);
     return (rc == -1) ? -1 : 0;
 }
 
-int port_write_data(const uint8_t *data, size_t len) {
+int port_write_cmds(port_t *port, const uint8_t *cmds, size_t n) {
+    if (!cmds || n == 0) return 0;
+    // Write as few transactions as possible: [0x00, c0..cN]
+    uint8_t buf[1 + PORT_I2C_MAX_XFER];
+    buf[0] = 0x00; // control byte for "command stream"
+    size_t written = 0;
+
+    while (written < n) {
+        size_t chunk = n - written;
+        if (chunk > PORT_I2C_MAX_XFER) chunk = PORT_I2C_MAX_XFER;
+        memcpy(&buf[1], &cmds[written], chunk);
+        ssize_t w = write(port->fd, buf, (unsigned)(1 + chunk));
+        if (w < 0) return -1;
+        written += chunk;
+    }
+    return 0;
+}
+
+size_t port_max_xfer(const port_t *port) { (void)port; return PORT_I2C_MAX_XFER; }
+
+int port_write_data(port_t *port, const uint8_t *data, size_t len) {
     if (!data || len == 0) return 0;
     // Write as repeated bursts: [0x40, d0..dN]
     uint8_t buf[1 + PORT_I2C_CHUNK];
@@ -54,13 +98,23 @@ int port_write_data(const uint8_t *data, size_t len) {
         size_t chunk = len - written;
         if (chunk > PORT_I2C_CHUNK) chunk = PORT_I2C_CHUNK;
         memcpy(&buf[1], &data[written], chunk);
-        ssize_t n = write(s_fd, buf, (unsigned)(1 + chunk));
+        ssize_t n = write(port->fd, buf, (unsigned)(1 + chunk));
         if (n < 0) return -1;
         written += chunk;
     }
     return 0;
 }
 
-const port_display_cfg_t* port_get_cfg(void) {
-    return &s_cfg;
-}
\ No newline at end of file
+int port_write_window(port_t *port, uint8_t *data, size_t span, size_t stride, size_t rows) {
+    if (!data) return -1;
+    // WiringPi has no scatter write; fall back to copying bursts per run.
+    if (stride == span) return port_write_data(port, data, span * rows);
+    for (size_t r = 0; r < rows; ++r) {
+        if (port_write_data(port, &data[r * stride], span) < 0) return -1;
+    }
+    return 0;
+}
+
+const port_display_cfg_t* port_get_cfg(const port_t *port) {
+    return port ? &port->cfg : NULL;
+}
@@ -1,89 +1,327 @@
 // src/ssd1306.c
 #include "ssd1306.h"
 #include "port.h"
-#include <stdlib.h>
+#include "perf.h"
 #include <string.h>
-#include <stdio.h>
+#ifndef SSD1306_FIXED_WIDTH
+#include <stdlib.h>
+#endif
 
-static int ssd1306_cmd(uint8_t c)             { return port_write_cmd(c); }
-static int ssd1306_data(const uint8_t* d, size_t n) { return port_write_data(d, n); }
+// Every bus access goes through these two, so they carry the port probes.
+static int ssd1306_cmds(ssd1306_t *dev, const uint8_t* c, size_t n) {
+    PERF_T0(t0);
+    const int rc = port_write_cmds(dev->port, c, n);
+    PERF_END(PERF_PORT_CMD, t0, n, rc);
+    return rc;
+}
+static int ssd1306_window_data(ssd1306_t *dev, uint8_t* d, size_t span, size_t stride, size_t rows) {
+    PERF_T0(t0);
+    const int rc = port_write_window(dev->port, d, span, stride, rows);
+    PERF_END(PERF_PORT_DATA, t0, span * rows, rc);
+    return rc;
+}
 
-static int ssd1306_configure_panel(const ssd1306_t *dev) {
-    (void)dev;
-    const port_display_cfg_t *cfg = port_get_cfg();
+static int ssd1306_configure_panel(ssd1306_t *dev) {
+    const port_display_cfg_t *cfg = port_get_cfg(dev->port);
     const uint8_t com_pins = (cfg->height == 64) ? 0x12 : 0x02; // panel variant
 
-    // Standard init sequence (horizontal addressing mode)
-    if (ssd1306_cmd(0xAE) < 0) return -1;               // Display OFF
-    if (ssd1306_cmd(0xD5) < 0 || ssd1306_cmd(0x80) < 0) return -1; // Clock
-    if (ssd1306_cmd(0xA8) < 0 || ssd1306_cmd((uint8_t)(cfg->height - 1)) < 0) return -1; // Multiplex
-    if (ssd1306_cmd(0xD3) < 0 || ssd1306_cmd(0x00) < 0) return -1; // Display offset
-    if (ssd1306_cmd(0x40) < 0) return -1;               // Start line = 0
-    if (ssd1306_cmd(0x8D) < 0 || ssd1306_cmd(0x14) < 0) return -1; // Charge pump on
-    if (ssd1306_cmd(0x20) < 0 || ssd1306_cmd(0x00) < 0) return -1; // Horizontal addressing
-    if (ssd1306_cmd(0xA1) < 0) return -1;               // Segment remap
-    if (ssd1306_cmd(0xC8) < 0) return -1;               // COM scan dec
-    if (ssd1306_cmd(0xDA) < 0 || ssd1306_cmd(com_pins) < 0) return -1; // COM pins
-    if (ssd1306_cmd(0x81) < 0 || ssd1306_cmd(0x7F) < 0) return -1;     // Contrast
-    if (ssd1306_cmd(0xD9) < 0 || ssd1306_cmd(0xF1) < 0) return -1;     // Pre-charge
-    if (ssd1306_cmd(0xDB) < 0 || ssd1306_cmd(0x40) < 0) return -1;     // VCOM
-    if (ssd1306_cmd(0xA4) < 0) return -1;               // Resume RAM content
-    if (ssd1306_cmd(0xA6) < 0) return -1;               // Normal (non-inverted)
-    if (ssd1306_cmd(0x2E) < 0) return -1;               // Deactivate scroll
-    if (ssd1306_cmd(0xAF) < 0) return -1;               // Display ON
-    return 0;
+    // Standard init sequence (horizontal addressing mode), sent as one command list
+    const uint8_t seq[] = {
+        0xAE,                               // Display OFF
+        0xD5, 0x80,                         // Clock
+        0xA8, (uint8_t)(cfg->height - 1),   // Multiplex
+        0xD3, 0x00,                         // Display offset
+        0x40,                               // Start line = 0
+        0x8D, 0x14,                         // Charge pump on
+        0x20, 0x00,                         // Horizontal addressing
+        0xA1,                               // Segment remap
+        0xC8,                               // COM scan dec
+        0xDA, com_pins,                     // COM pins
+        0x81, 0x7F,                         // Contrast
+        0xD9, 0xF1,                         // Pre-charge
+        0xDB, 0x40,                         // VCOM
+        0xA4,                               // Resume RAM content
+        0xA6,                               // Normal (non-inverted)
+        0x2E,                               // Deactivate scroll
+        0xAF,                               // Display ON
+    };
+    return ssd1306_cmds(dev, seq, sizeof(seq)) < 0 ? -1 : 0;
 }
 
-int ssd1306_init(ssd1306_t *dev) {
-    if (!dev) return -1;
-    const port_display_cfg_t *cfg = port_get_cfg();
+// ---------- Framebuffer storage ----------
+// One spare byte in front of the framebuffer lets the port place the 0x40
+// control byte there and send the frame without copying it.
+#ifdef SSD1306_FIXED_WIDTH
+#define FB_BYTES  ((size_t)SSD1306_FIXED_WIDTH * (SSD1306_FIXED_HEIGHT / 8))
+
+static uint8_t s_fb[SSD1306_FIXED_PANELS][1 + FB_BYTES];
+static uint8_t s_shadow[SSD1306_FIXED_PANELS][FB_BYTES];
+static bool    s_fb_used[SSD1306_FIXED_PANELS];
+
+static int fb_alloc(ssd1306_t *dev, size_t bytes) {
+    if (bytes != FB_BYTES) return -1;
+    for (int i = 0; i < SSD1306_FIXED_PANELS; ++i) {
+        if (s_fb_used[i]) continue;
+        s_fb_used[i] = true;
+        dev->buffer = &s_fb[i][1];
+        dev->shadow = s_shadow[i];
+        return 0;
+    }
+    return -1;
+}
+
+static void fb_free(ssd1306_t *dev) {
+    for (int i = 0; i < SSD1306_FIXED_PANELS; ++i) {
+        if (dev->buffer == &s_fb[i][1]) s_fb_used[i] = false;
+    }
+}
+#else
+static int fb_alloc(ssd1306_t *dev, size_t bytes) {
+    uint8_t *block = (uint8_t*)malloc(1 + bytes);
+    dev->buffer = block ? block + 1 : NULL;
+    dev->shadow = (uint8_t*)malloc(bytes);
+    return (dev->buffer && dev->shadow) ? 0 : -1;
+}
+
+static void fb_free(ssd1306_t *dev) {
+    if (dev->buffer) free(dev->buffer - 1);   // allocation starts at the spare byte
+    free(dev->shadow);
+}
+#endif
+
+static void dirty_reset(ssd1306_t *dev);
+
+// Everything but talking to the panel: geometry, buffers, clean state.
+static int init_device(ssd1306_t *dev, port_t *port) {
+    if (!dev || !port) return -1;
+    const port_display_cfg_t *cfg = port_get_cfg(port);
     if (!cfg || cfg->width == 0 || cfg->height == 0) return -2;
+    if (cfg->width > 128 || cfg->height / 8 > SSD1306_MAX_PAGES) return -2;
+#ifdef SSD1306_FIXED_WIDTH
+    if (cfg->width != SSD1306_FIXED_WIDTH || cfg->height != SSD1306_FIXED_HEIGHT) return -2;
+#endif
 
+    dev->port   = port;
     dev->width  = cfg->width;
     dev->height = cfg->height;
     dev->pages  = (uint8_t)(cfg->height / 8);
     size_t bytes = (size_t)dev->width * dev->pages;
-    dev->buffer = (uint8_t*)malloc(bytes);
-    if (!dev->buffer) return -3;
+    if (fb_alloc(dev, bytes) < 0) { ssd1306_deinit(dev); return -3; }
 
     memset(dev->buffer, 0, bytes);
+    memset(dev->shadow, 0, bytes);
+    dev->synced = false;            // panel RAM is unknown until the first push
+    dev->last_flush_bytes = 0;
+    dev->async = NULL;
+    dev->on_flush = NULL;
+    dev->on_flush_ctx = NULL;
+    dev->remote_submit = NULL;
+    dev->remote_ctx = NULL;
+    ssd1306_bind_surface(dev);
+    ssd1306_mark_all_dirty(dev);
+    return 0;
+}
+
+int ssd1306_init(ssd1306_t *dev, port_t *port) {
+    const int rc = init_device(dev, port);
+    if (rc < 0) return rc;
     if (ssd1306_configure_panel(dev) < 0) return -4;
     return 0;
 }
 
+int ssd1306_init_warm(ssd1306_t *dev, port_t *port, const uint8_t *frame) {
+    const int rc = init_device(dev, port);
+    if (rc < 0) return rc;
+
+    // Only the state the flush path relies on; everything else is as the
+    // previous run left it, so the panel keeps showing its picture.
+    const uint8_t seq[] = {
+        0x20, 0x00,                         // Horizontal addressing
+        0x40,                               // Start line = 0
+        0xAF,                               // Display ON (no-op when already on)
+    };
+    if (ssd1306_cmds(dev, seq, sizeof(seq)) < 0) return -4;
+
+    if (frame) {
+        const size_t bytes = (size_t)SSD1306_WIDTH(dev) * SSD1306_PAGES(dev);
+        memcpy(dev->buffer, frame, bytes);
+        memcpy(dev->shadow, frame, bytes);
+        dev->synced = true;
+        dirty_reset(dev);
+    }
+    return 0;
+}
+
 void ssd1306_deinit(ssd1306_t *dev) {
-    if (dev && dev->buffer) { free(dev->buffer); dev->buffer = NULL; }
+    if (!dev) return;
+    fb_free(dev);
+    dev->buffer = NULL;
+    dev->shadow = NULL;
+    dev->surface.buf = NULL;
+}
+
+// ---------- Dirty tracking ----------
+static void dirty_reset(ssd1306_t *dev) {
+    for (int p = 0; p < SSD1306_MAX_PAGES; ++p) {
+        dev->dirty_x0[p] = 0xFF;
+        dev->dirty_x1[p] = 0x00;
+    }
+}
+
+void ssd1306_mark_dirty(ssd1306_t *dev, int x, int y, int w, int h) {
+    if (!dev || w <= 0 || h <= 0) return;
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + w - 1; if (x1 >= (int)SSD1306_WIDTH(dev))  x1 = SSD1306_WIDTH(dev) - 1;
+    int y1 = y + h - 1; if (y1 >= (int)SSD1306_HEIGHT(dev)) y1 = SSD1306_HEIGHT(dev) - 1;
+    if (x0 > x1 || y0 > y1) return;
+    for (int p = y0 >> 3; p <= (y1 >> 3); ++p) ssd1306_mark_dirty_span(dev, p, x0, x1);
+}
+
+void ssd1306_mark_all_dirty(ssd1306_t *dev) {
+    if (!dev) return;
+    dirty_reset(dev);
+    for (int p = 0; p < SSD1306_PAGES(dev); ++p) ssd1306_mark_dirty_span(dev, p, 0, SSD1306_WIDTH(dev) - 1);
 }
 
 void ssd1306_clear(ssd1306_t *dev) {
     if (!dev || !dev->buffer) return;
-    memset(dev->buffer, 0, (size_t)dev->width * dev->pages);
+    // Only lit bytes change when clearing; mark just their span per page.
+    for (int p = 0; p < SSD1306_PAGES(dev); ++p) {
+        const uint8_t *row = &dev->buffer[(size_t)p * SSD1306_WIDTH(dev)];
+        int x0 = 0, x1 = SSD1306_WIDTH(dev) - 1;
+        while (x0 <= x1 && row[x0] == 0) ++x0;
+        while (x1 >= x0 && row[x1] == 0) --x1;
+        if (x0 <= x1) ssd1306_mark_dirty_span(dev, p, x0, x1);
+    }
+    memset(dev->buffer, 0, (size_t)SSD1306_WIDTH(dev) * SSD1306_PAGES(dev));
+}
+
+// ---------- Flushing ----------
+// Set the column/page address window. Returns command bytes sent or <0.
+static int ssd1306_set_window(ssd1306_t *dev, uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+    const uint8_t win[] = { 0x21, x0, x1, 0x22, p0, p1 };
+    if (ssd1306_cmds(dev, win, sizeof(win)) < 0) return -1;
+    return (int)sizeof(win);
 }
 
-int ssd1306_update_full(const ssd1306_t *dev) {
+static int update_full(ssd1306_t *dev) {
     if (!dev || !dev->buffer) return -1;
+    dev->last_flush_bytes = 0;
     // Set window to full screen: columns 0..W-1, pages 0..P-1
-    if (ssd1306_cmd(0x21) < 0) return -1;
-    if (ssd1306_cmd(0x00) < 0) return -1;
-    if (ssd1306_cmd((uint8_t)(dev->width - 1)) < 0) return -1;
+    int rc = ssd1306_set_window(dev, 0x00, (uint8_t)(SSD1306_WIDTH(dev) - 1), 0x00, (uint8_t)(SSD1306_PAGES(dev) - 1));
+    if (rc < 0) return -1;
+
+    size_t n = (size_t)SSD1306_WIDTH(dev) * SSD1306_PAGES(dev);
+    if (ssd1306_window_data(dev, dev->buffer, n, n, 1) < 0) return -1;
+
+    memcpy(dev->shadow, dev->buffer, n);
+    dev->synced = true;
+    dev->last_flush_bytes = (size_t)rc + n;
+    dirty_reset(dev);
+    if (dev->on_flush) dev->on_flush(dev->on_flush_ctx, dev);
+    return 0;
+}
+
+// Extra data bytes worth sending to avoid opening another address window
+// (one 6-byte command transaction plus the next data transaction's overhead).
+#ifndef SSD1306_WINDOW_COST
+#define SSD1306_WINDOW_COST  10
+#endif
+
+static int update_dirty(ssd1306_t *dev) {
+    if (!dev || !dev->buffer) return -1;
+    if (!dev->synced) return ssd1306_update_full(dev);
+    dev->last_flush_bytes = 0;
+
+    // Trim each dirty span to the bytes that really differ from the panel.
+    int x0[SSD1306_MAX_PAGES], x1[SSD1306_MAX_PAGES];
+    for (int p = 0; p < SSD1306_PAGES(dev); ++p) {
+        const size_t row = (size_t)p * SSD1306_WIDTH(dev);
+        int a = dev->dirty_x0[p], b = dev->dirty_x1[p];
+        if (b >= (int)SSD1306_WIDTH(dev)) b = SSD1306_WIDTH(dev) - 1;
+        while (a <= b && dev->buffer[row + a] == dev->shadow[row + a]) ++a;
+        while (b >= a && dev->buffer[row + b] == dev->shadow[row + b]) --b;
+        x0[p] = a; x1[p] = b;
+    }
+
+    int p = 0;
+    while (p < SSD1306_PAGES(dev)) {
+        if (x0[p] > x1[p]) { ++p; continue; }
+
+        // Grow a window over following pages while the union stays cheaper
+        // than sending those pages in a window of their own.
+        int p0 = p, p1 = p, wx0 = x0[p], wx1 = x1[p];
+        size_t useful = (size_t)(wx1 - wx0 + 1);
+        for (int q = p + 1; q < SSD1306_PAGES(dev); ++q) {
+            int nx0 = wx0, nx1 = wx1;
+            size_t q_bytes = 0;
+            if (x0[q] <= x1[q]) {
+                if (x0[q] < nx0) nx0 = x0[q];
+                if (x1[q] > nx1) nx1 = x1[q];
+                q_bytes = (size_t)(x1[q] - x0[q] + 1);
+            }
+            size_t merged = (size_t)(nx1 - nx0 + 1) * (size_t)(q - p0 + 1);
+            if (merged > useful + q_bytes + SSD1306_WINDOW_COST) break;
+            // Don't end a window on a clean page; only commit when q is dirty.
+            if (q_bytes == 0) continue;
+            p1 = q; wx0 = nx0; wx1 = nx1; useful += q_bytes;
+        }
+
+        int rc = ssd1306_set_window(dev, (uint8_t)wx0, (uint8_t)wx1, (uint8_t)p0, (uint8_t)p1);
+        if (rc < 0) return -1;
+        dev->last_flush_bytes += (size_t)rc;
+
+        const size_t span = (size_t)(wx1 - wx0 + 1);
+        const size_t first = (size_t)p0 * SSD1306_WIDTH(dev) + (size_t)wx0;
+        const size_t rows = (size_t)(p1 - p0 + 1);
+        // One run per page; full-width windows collapse to one contiguous block
+        if (ssd1306_window_data(dev, &dev->buffer[first], span, SSD1306_WIDTH(dev), rows) < 0) return -1;
+        for (int q = p0; q <= p1; ++q) {
+            const size_t off = (size_t)q * SSD1306_WIDTH(dev) + (size_t)wx0;
+            memcpy(&dev->shadow[off], &dev->buffer[off], span);
+        }
+        dev->last_flush_bytes += span * rows;
+        p = p1 + 1;
+    }
 
-    if (ssd1306_cmd(0x22) < 0) return -1;
-    if (ssd1306_cmd(0x00) < 0) return -1;
-    if (ssd1306_cmd((uint8_t)(dev->pages - 1)) < 0) return -1;
+    dirty_reset(dev);
+    if (dev->on_flush && dev->last_flush_bytes) dev->on_flush(dev->on_flush_ctx, dev);
+    return 0;
+}
+
+int ssd1306_update_full(ssd1306_t *dev) {
+    PERF_T0(t0);
+    const int rc = update_full(dev);
+    PERF_END(PERF_UPDATE_FULL, t0, rc < 0 ? 0 : dev->last_flush_bytes, rc);
+    if (rc == 0) PERF_FRAME_ON_PANEL();
+    return rc;
+}
+
+int ssd1306_update_dirty(ssd1306_t *dev) {
+    PERF_T0(t0);
+    const int rc = update_dirty(dev);
+    PERF_END(PERF_UPDATE_DIRTY, t0, rc < 0 ? 0 : dev->last_flush_bytes, rc);
+    if (rc == 0) PERF_FRAME_ON_PANEL();     // includes "panel already shows it"
+    return rc;
+}
 
-    size_t n = (size_t)dev->width * dev->pages;
-    return ssd1306_data(dev->buffer, n);
+int ssd1306_set_contrast(ssd1306_t *dev, uint8_t value) {
+    const uint8_t seq[] = { 0x81, value };
+    return ssd1306_cmds(dev, seq, sizeof(seq));
 }
 
-int ssd1306_set_contrast(uint8_t value) {
-    if (ssd1306_cmd(0x81) < 0) return -1;
-    return ssd1306_cmd(value);
+int ssd1306_set_invert(ssd1306_t *dev, bool enable) {
+    const uint8_t c = enable ? 0xA7 : 0xA6;
+    return ssd1306_cmds(dev, &c, 1);
 }
 
-int ssd1306_set_invert(bool enable) {
-    return ssd1306_cmd(enable ? 0xA7 : 0xA6);
+int ssd1306_display_on(ssd1306_t *dev, bool on) {
+    const uint8_t c = on ? 0xAF : 0xAE;
+    return ssd1306_cmds(dev, &c, 1);
 }
 
-int ssd1306_display_on(bool on) {
-    return ssd1306_cmd(on ? 0xAF : 0xAE);
+int ssd1306_set_start_line(ssd1306_t *dev, uint8_t line) {
+    const uint8_t c = (uint8_t)(0x40 | (line & 0x3F));
+    return ssd1306_cmds(dev, &c, 1);
 }
\ No newline at end of file
@@ -0,0 +1,262 @@
+// src/ssd1306_async.c
+// Background flushing with latest-frame-wins coalescing, one flush thread per
+// I2C bus (see ssd1306_async.h).
+#define _POSIX_C_SOURCE 200809L
+#include "ssd1306_async.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct flush_bus;
+
+// Per panel. Everything below 'bus' is guarded by the bus lock.
+struct ssd1306_async {
+    struct flush_bus *bus;
+
+    // Mailbox: the newest submitted frame and the union of dirty regions of
+    // every frame submitted since the thread last took one.
+    uint8_t         *mail;
+    uint8_t          mail_x0[SSD1306_MAX_PAGES];
+    uint8_t          mail_x1[SSD1306_MAX_PAGES];
+    int64_t          mail_seq;      // sequence number of the frame in the mailbox
+    int64_t          taken_seq;     // last frame the thread took from the mailbox
+    int64_t          flushed_seq;   // last frame fully on the panel
+    int64_t          failed_from;   // frames (failed_from, failed_seq] went out
+    int64_t          failed_seq;    // in the most recent flush that failed,
+    int              failed_rc;     // with this error
+
+    // Panel-side device: front buffer + the panel shadow, owned by the thread.
+    ssd1306_t        front;
+
+    ssd1306_async_stats_t stats;
+};
+
+// One thread per bus. Panels that share it are served round-robin, one frame
+// each per turn, so a panel redrawing flat out cannot starve its neighbours;
+// panels on other buses have their own thread and transfer in parallel.
+struct flush_bus {
+    uint8_t          id;            // cfg.i2c_bus
+    pthread_t        thread;
+    pthread_mutex_t  lock;
+    pthread_cond_t   wake;          // flush thread: new frame or stop
+    pthread_cond_t   done;          // waiters: a frame reached its panel
+    struct ssd1306_async *panels[SSD1306_ASYNC_MAX_PER_BUS];
+    int              npanels;
+    int              next;          // round-robin cursor into panels[]
+    bool             stop;
+    struct flush_bus *link;
+};
+
+// Running bus threads; start/stop are serialised by the registry lock.
+static pthread_mutex_t   s_registry = PTHREAD_MUTEX_INITIALIZER;
+static struct flush_bus *s_buses;
+
+static void spans_clean(uint8_t *x0, uint8_t *x1) {
+    memset(x0, 0xFF, SSD1306_MAX_PAGES);
+    memset(x1, 0x00, SSD1306_MAX_PAGES);
+}
+
+// Next panel with an unsent frame, starting after the one served last.
+static struct ssd1306_async *next_pending(struct flush_bus *b) {
+    for (int i = 0; i < b->npanels; ++i) {
+        const int k = (b->next + i) % b->npanels;
+        struct ssd1306_async *a = b->panels[k];
+        if (a->mail_seq != a->taken_seq) { b->next = (k + 1) % b->npanels; return a; }
+    }
+    return NULL;
+}
+
+static void *bus_main(void *arg) {
+    struct flush_bus *b = (struct flush_bus *)arg;
+    pthread_mutex_lock(&b->lock);
+    for (;;) {
+        struct ssd1306_async *a = next_pending(b);
+        if (!a) {
+            if (b->stop) break;     // stopping with nothing pending
+            pthread_cond_wait(&b->wake, &b->lock);
+            continue;
+        }
+
+        // Take the newest frame: swap it into the front buffer (the old front
+        // becomes the next mailbox; submit always rewrites it completely).
+        // The spans are merged, not copied: after a failed flush the front
+        // still holds the regions that never reached the panel.
+        uint8_t *t = a->front.buffer; a->front.buffer = a->mail; a->mail = t;
+        for (int p = 0; p < SSD1306_MAX_PAGES; ++p) {
+            if (a->mail_x0[p] < a->front.dirty_x0[p]) a->front.dirty_x0[p] = a->mail_x0[p];
+            if (a->mail_x1[p] > a->front.dirty_x1[p]) a->front.dirty_x1[p] = a->mail_x1[p];
+        }
+        spans_clean(a->mail_x0, a->mail_x1);
+        const int64_t from = a->taken_seq;
+        const int64_t seq = a->taken_seq = a->mail_seq;
+        pthread_mutex_unlock(&b->lock);
+
+        const int rc = ssd1306_update_dirty(&a->front);
+
+        pthread_mutex_lock(&b->lock);
+        a->flushed_seq = seq;
+        a->stats.flushed++;
+        a->stats.last_error = rc < 0 ? rc : 0;
+        if (rc < 0) { a->failed_from = from; a->failed_seq = seq; a->failed_rc = rc; }
+        pthread_cond_broadcast(&b->done);
+    }
+    pthread_mutex_unlock(&b->lock);
+    return NULL;
+}
+
+// Find or start the thread for bus 'id'. Registry lock held.
+static struct flush_bus *bus_get(uint8_t id) {
+    for (struct flush_bus *b = s_buses; b; b = b->link) if (b->id == id) return b;
+
+    struct flush_bus *b = (struct flush_bus *)calloc(1, sizeof(*b));
+    if (!b) return NULL;
+    b->id = id;
+    pthread_mutex_init(&b->lock, NULL);
+    pthread_cond_init(&b->wake, NULL);
+    pthread_cond_init(&b->done, NULL);
+    if (pthread_create(&b->thread, NULL, bus_main, b) != 0) {
+        pthread_cond_destroy(&b->done);
+        pthread_cond_destroy(&b->wake);
+        pthread_mutex_destroy(&b->lock);
+        free(b);
+        return NULL;
+    }
+    b->link = s_buses;
+    s_buses = b;
+    return b;
+}
+
+// Stop and free the thread of a bus with no panels left. Registry lock held.
+static void bus_put(struct flush_bus *b) {
+    if (b->npanels) return;
+    for (struct flush_bus **pp = &s_buses; *pp; pp = &(*pp)->link) {
+        if (*pp == b) { *pp = b->link; break; }
+    }
+    pthread_mutex_lock(&b->lock);
+    b->stop = true;
+    pthread_cond_signal(&b->wake);
+    pthread_mutex_unlock(&b->lock);
+    pthread_join(b->thread, NULL);
+
+    pthread_cond_destroy(&b->done);
+    pthread_cond_destroy(&b->wake);
+    pthread_mutex_destroy(&b->lock);
+    free(b);
+}
+
+int ssd1306_async_start(ssd1306_t *dev) {
+    if (!dev || !dev->buffer || !dev->port || dev->async) return -1;
+    const size_t bytes = (size_t)dev->width * dev->pages;
+
+    struct ssd1306_async *a = (struct ssd1306_async *)calloc(1, sizeof(*a));
+    if (!a) return -3;
+    // Both buffers keep the spare control-byte slot in front (zero-copy ports).
+    uint8_t *front = (uint8_t *)malloc(1 + bytes);
+    uint8_t *mail  = (uint8_t *)malloc(1 + bytes);
+    if (!front || !mail) { free(front); free(mail); free(a); return -3; }
+
+    a->front = *dev;                    // port, geometry, shadow, synced state
+    a->front.buffer = front + 1;
+    a->front.async  = NULL;
+    memcpy(a->front.buffer, dev->shadow, bytes);
+    spans_clean(a->front.dirty_x0, a->front.dirty_x1);
+    a->mail = mail + 1;
+    spans_clean(a->mail_x0, a->mail_x1);
+
+    pthread_mutex_lock(&s_registry);
+    struct flush_bus *b = bus_get(port_get_cfg(dev->port)->i2c_bus);
+    int rc = b ? 0 : -4;
+    if (b) {
+        pthread_mutex_lock(&b->lock);
+        if (b->npanels < SSD1306_ASYNC_MAX_PER_BUS) {
+            a->bus = b;
+            b->panels[b->npanels++] = a;
+        } else {
+            rc = -5;
+        }
+        pthread_mutex_unlock(&b->lock);
+    }
+    pthread_mutex_unlock(&s_registry);
+
+    if (rc < 0) { free(front); free(mail); free(a); return rc; }
+    dev->async = a;
+    return 0;
+}
+
+void ssd1306_async_stop(ssd1306_t *dev) {
+    if (!dev || !dev->async) return;
+    struct ssd1306_async *a = dev->async;
+    struct flush_bus *b = a->bus;
+
+    pthread_mutex_lock(&s_registry);
+    pthread_mutex_lock(&b->lock);
+    // Let the thread send the last submitted frame, then leave the rotation
+    while (a->flushed_seq != a->mail_seq) pthread_cond_wait(&b->done, &b->lock);
+    for (int i = 0; i < b->npanels; ++i) {
+        if (b->panels[i] != a) continue;
+        memmove(&b->panels[i], &b->panels[i + 1], (size_t)(b->npanels - i - 1) * sizeof(b->panels[0]));
+        --b->npanels;
+        if (b->next > i) --b->next;
+        if (b->next >= b->npanels) b->next = 0;
+        break;
+    }
+    pthread_mutex_unlock(&b->lock);
+    bus_put(b);
+    pthread_mutex_unlock(&s_registry);
+
+    // Back to synchronous flushing: the panel shadow was kept up to date by
+    // the thread; hand its bookkeeping back to the caller's device.
+    dev->synced = a->front.synced;
+    dev->last_flush_bytes = a->front.last_flush_bytes;
+
+    free(a->front.buffer - 1);
+    free(a->mail - 1);
+    free(a);
+    dev->async = NULL;
+}
+
+int64_t ssd1306_submit(ssd1306_t *dev) {
+    if (!dev || !dev->buffer) return -1;
+    if (dev->remote_submit) return dev->remote_submit(dev->remote_ctx, dev) < 0 ? -1 : 0;
+    struct ssd1306_async *a = dev->async;
+    if (!a) return ssd1306_update_dirty(dev) < 0 ? -1 : 0;
+    struct flush_bus *b = a->bus;
+
+    pthread_mutex_lock(&b->lock);
+    memcpy(a->mail, dev->buffer, (size_t)dev->width * dev->pages);
+    for (int p = 0; p < dev->pages; ++p) {
+        if (dev->dirty_x0[p] < a->mail_x0[p]) a->mail_x0[p] = dev->dirty_x0[p];
+        if (dev->dirty_x1[p] > a->mail_x1[p]) a->mail_x1[p] = dev->dirty_x1[p];
+    }
+    if (a->mail_seq != a->taken_seq) a->stats.dropped++;   // replaces an unsent frame
+    const int64_t seq = ++a->mail_seq;
+    a->stats.submitted++;
+    pthread_cond_signal(&b->wake);
+    pthread_mutex_unlock(&b->lock);
+
+    spans_clean(dev->dirty_x0, dev->dirty_x1);   // now tracked by the mailbox
+    return seq;
+}
+
+int ssd1306_wait_frame(ssd1306_t *dev, int64_t seq) {
+    if (!dev) return -1;
+    struct ssd1306_async *a = dev->async;
+    if (!a || seq <= 0) return 0;
+    struct flush_bus *b = a->bus;
+
+    pthread_mutex_lock(&b->lock);
+    while (a->flushed_seq < seq) pthread_cond_wait(&b->done, &b->lock);
+    // The flush that carried 'seq' (it may have replaced older frames too)
+    const int rc = seq > a->failed_from && seq <= a->failed_seq ? a->failed_rc : 0;
+    pthread_mutex_unlock(&b->lock);
+    return rc;
+}
+
+void ssd1306_async_get_stats(ssd1306_t *dev, ssd1306_async_stats_t *out) {
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+    if (!dev || !dev->async) return;
+    pthread_mutex_lock(&dev->async->bus->lock);
+    *out = dev->async->stats;
+    pthread_mutex_unlock(&dev->async->bus->lock);
+}
@@ -0,0 +1,232 @@
+// src/ssd1306_capture.c
+// Frame capture hook and reader (see ssd1306_capture.h).
+#define _POSIX_C_SOURCE 200809L   // clock_gettime
+#include "ssd1306_capture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define FB_MAX   (128 * SSD1306_MAX_PAGES)
+#define REC_MAX  (9 + 1 + 10 + 1 + SSD1306_MAX_PAGES * (2 + 128))   // 'S' + the largest 'F' record
+
+struct ssd1306_capture {
+    FILE    *f;
+    char    *path;
+    size_t   max_bytes;                 // rotate beyond this (0: never)
+    size_t   written;                   // current file size
+    uint16_t width, height;
+    bool     in_session;                // false: next frame starts a session
+    uint64_t last_ns;                   // CLOCK_MONOTONIC of the previous frame
+    uint8_t  prev[FB_MAX];              // the previous recorded frame
+    uint8_t  rec[REC_MAX];
+};
+
+static uint64_t clock_us(clockid_t id) {
+    struct timespec ts;
+    clock_gettime(id, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ull + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static size_t put_u16(uint8_t *p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); return 2; }
+
+static size_t put_varint(uint8_t *p, uint64_t v) {
+    size_t n = 0;
+    while (v >= 0x80) { p[n++] = (uint8_t)(v | 0x80); v >>= 7; }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+// Append one whole record and flush it (keeps the file current for post-mortem
+// reads). On a write error the partial record is cut off and the recorder
+// stops: frames appended behind it would be unreadable.
+static int write_all(struct ssd1306_capture *c, const uint8_t *p, size_t n) {
+    if (fwrite(p, 1, n, c->f) == n && fflush(c->f) == 0) {
+        c->written += n;
+        return 0;
+    }
+    fclose(c->f);
+    c->f = NULL;
+    if (truncate(c->path, (off_t)c->written) != 0) {}   // best effort: the file ends at the last record
+    return -1;
+}
+
+// Open c->path for appending; a new or empty file gets a header.
+static int capture_open(struct ssd1306_capture *c) {
+    c->f = fopen(c->path, "a+b");
+    if (!c->f) return -1;
+    fseek(c->f, 0, SEEK_END);
+    const long size = ftell(c->f);
+    uint8_t hdr[SSD1306_CAPTURE_HDR_LEN];
+    memcpy(hdr, SSD1306_CAPTURE_MAGIC, 8);
+    put_u16(&hdr[8], c->width);
+    put_u16(&hdr[10], c->height);
+
+    if (size <= 0) {
+        c->written = 0;
+        if (write_all(c, hdr, sizeof(hdr)) < 0) return -1;
+    } else {
+        // Append only to a capture of the same panel
+        uint8_t have[SSD1306_CAPTURE_HDR_LEN];
+        rewind(c->f);
+        if (fread(have, 1, sizeof(have), c->f) != sizeof(have) || memcmp(have, hdr, sizeof(hdr)) != 0) return -2;
+        fseek(c->f, 0, SEEK_END);
+        c->written = (size_t)size;
+    }
+    c->in_session = false;
+    return 0;
+}
+
+static void capture_frame(void *ctx, const ssd1306_t *dev) {
+    struct ssd1306_capture *c = (struct ssd1306_capture *)ctx;
+    if (!c->f) return;                  // a write error or failed rotation leaves the recorder off
+    const int W = SSD1306_WIDTH(dev), P = SSD1306_PAGES(dev);
+    const uint8_t *fb = dev->shadow;
+    const uint64_t now = clock_us(CLOCK_MONOTONIC);
+
+    // A session's 'S' goes out together with its first frame, so a write
+    // error never leaves a session without one
+    uint8_t *r = c->rec;
+    size_t n = 0;
+    uint64_t dt = 0;
+    if (!c->in_session) {
+        const uint64_t wall = clock_us(CLOCK_REALTIME);
+        r[n++] = 'S';
+        for (int i = 0; i < 8; ++i) r[n++] = (uint8_t)(wall >> (8 * i));
+    } else {
+        dt = now - c->last_ns;
+    }
+
+    // One run per page covering the bytes that differ from the previous frame
+    r[n++] = 'F';
+    n += put_varint(&r[n], dt);
+    const size_t mask_at = n++;
+    uint8_t mask = 0;
+    for (int p = 0; p < P; ++p) {
+        const uint8_t *now_row = &fb[(size_t)p * W], *old_row = &c->prev[(size_t)p * W];
+        int a = 0, b = W - 1;
+        if (c->in_session) {
+            while (a <= b && now_row[a] == old_row[a]) ++a;
+            while (b >= a && now_row[b] == old_row[b]) --b;
+            if (a > b) continue;
+        }
+        mask |= (uint8_t)(1u << p);
+        r[n++] = (uint8_t)a;
+        r[n++] = (uint8_t)(b - a);
+        memcpy(&r[n], &now_row[a], (size_t)(b - a + 1));
+        n += (size_t)(b - a + 1);
+    }
+    if (!mask) return;                  // the push re-sent what was already there
+    r[mask_at] = mask;
+
+    if (write_all(c, r, n) < 0) return;
+    memcpy(c->prev, fb, (size_t)W * P);
+    c->last_ns = now;
+    c->in_session = true;
+
+    if (c->max_bytes && c->written >= c->max_bytes) {
+        // Rotate: the full file becomes <path>.1, a new one starts with a session
+        fclose(c->f);
+        c->f = NULL;
+        const size_t len = strlen(c->path);
+        char *old = (char *)malloc(len + 3);
+        if (!old) return;
+        memcpy(old, c->path, len);
+        memcpy(old + len, ".1", 3);
+        rename(c->path, old);
+        free(old);
+        if (capture_open(c) < 0 && c->f) { fclose(c->f); c->f = NULL; }
+    }
+}
+
+int ssd1306_capture_start(ssd1306_t *dev, const char *path, size_t max_bytes) {
+    if (!dev || !dev->buffer || !path || dev->on_flush || dev->async) return -1;
+    struct ssd1306_capture *c = (struct ssd1306_capture *)calloc(1, sizeof(*c));
+    if (!c || !(c->path = strdup(path))) { free(c); return -3; }
+    c->max_bytes = max_bytes;
+    c->width  = (uint16_t)SSD1306_WIDTH(dev);
+    c->height = (uint16_t)SSD1306_HEIGHT(dev);
+
+    const int rc = capture_open(c);
+    if (rc < 0) {
+        if (c->f) fclose(c->f);
+        free(c->path);
+        free(c);
+        return rc - 3;                  // -4: cannot open, -5: another panel's capture
+    }
+    dev->on_flush = capture_frame;
+    dev->on_flush_ctx = c;
+    return 0;
+}
+
+void ssd1306_capture_stop(ssd1306_t *dev) {
+    if (!dev || dev->on_flush != capture_frame) return;
+    struct ssd1306_capture *c = (struct ssd1306_capture *)dev->on_flush_ctx;
+    if (c->f) fclose(c->f);
+    free(c->path);
+    free(c);
+    dev->on_flush = NULL;
+    dev->on_flush_ctx = NULL;
+}
+
+// ---------- Reader ----------
+static uint16_t get_u16(const uint8_t *p) { return (uint16_t)(p[0] | p[1] << 8); }
+
+int ssd1306_capture_reader_init(ssd1306_capture_reader_t *r, const void *data, size_t len) {
+    if (!r || !data) return -1;
+    const uint8_t *p = (const uint8_t *)data;
+    if (len < SSD1306_CAPTURE_HDR_LEN || memcmp(p, SSD1306_CAPTURE_MAGIC, 8) != 0) return -2;
+    memset(r, 0, sizeof(*r));
+    r->width  = get_u16(&p[8]);
+    r->height = get_u16(&p[10]);
+    if (r->width == 0 || r->width > 128 || r->height == 0 || r->height % 8 || r->height / 8 > SSD1306_MAX_PAGES) return -2;
+    r->pos = p + SSD1306_CAPTURE_HDR_LEN;
+    r->end = p + len;
+    return 0;
+}
+
+int ssd1306_capture_read(ssd1306_capture_reader_t *r, ssd1306_t *dev) {
+    if (!r || !dev || !dev->buffer) return -1;
+    if (SSD1306_WIDTH(dev) != r->width || SSD1306_HEIGHT(dev) != r->height) return -2;
+    const int W = r->width, P = r->height / 8;
+    const uint8_t *p = r->pos, *end = r->end;
+
+    while (p < end && *p == 'S') {
+        if (end - p < 9) return -3;
+        uint64_t wall = 0;
+        for (int i = 0; i < 8; ++i) wall |= (uint64_t)p[1 + i] << (8 * i);
+        r->wall_us = wall;
+        r->sessions++;
+        p += 9;
+    }
+    if (p == end) { r->pos = p; return 0; }
+    if (*p++ != 'F') return -3;
+
+    uint64_t dt = 0;
+    for (int shift = 0;; shift += 7) {
+        if (p == end || shift > 63) return -3;
+        const uint8_t b = *p++;
+        dt |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) break;
+    }
+    if (p == end) return -3;
+    const uint8_t mask = *p++;
+    if (mask >> P) return -3;
+
+    for (int pg = 0; pg < P; ++pg) {
+        if (!((mask >> pg) & 1u)) continue;
+        if (end - p < 2) return -3;
+        const int x0 = p[0], n = p[1] + 1;
+        p += 2;
+        if (x0 + n > W || end - p < n) return -3;
+        memcpy(&dev->buffer[(size_t)pg * W + (size_t)x0], p, (size_t)n);
+        ssd1306_mark_dirty_span(dev, pg, x0, x0 + n - 1);
+        p += n;
+    }
+
+    r->pos = p;
+    r->t_us += dt;
+    r->frames++;
+    return 1;
+}
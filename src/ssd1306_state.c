@@ -0,0 +1,46 @@
+// src/ssd1306_state.c
+// Panel state file for warm attach (see ssd1306_state.h).
+#include "ssd1306_state.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HDR_LEN  12
+
+int ssd1306_state_save(const ssd1306_t *dev, const char *path) {
+    if (!dev || !dev->shadow || !dev->synced || !path) return -1;
+    const uint16_t w = (uint16_t)SSD1306_WIDTH(dev), h = (uint16_t)SSD1306_HEIGHT(dev);
+    uint8_t hdr[HDR_LEN];
+    memcpy(hdr, SSD1306_STATE_MAGIC, 8);
+    hdr[8]  = (uint8_t)w; hdr[9]  = (uint8_t)(w >> 8);
+    hdr[10] = (uint8_t)h; hdr[11] = (uint8_t)(h >> 8);
+
+    const size_t len = strlen(path);
+    char *tmp = (char *)malloc(len + 5);
+    if (!tmp) return -1;
+    memcpy(tmp, path, len);
+    memcpy(tmp + len, ".tmp", 5);
+
+    const size_t bytes = (size_t)w * (h / 8u);
+    FILE *f = fopen(tmp, "wb");
+    int rc = f ? 0 : -1;
+    if (f && (fwrite(hdr, 1, HDR_LEN, f) != HDR_LEN || fwrite(dev->shadow, 1, bytes, f) != bytes)) rc = -1;
+    if (f && fclose(f) != 0) rc = -1;
+    if (rc == 0 && rename(tmp, path) != 0) rc = -1;
+    if (rc < 0) remove(tmp);
+    free(tmp);
+    return rc;
+}
+
+int ssd1306_state_load(const char *path, uint16_t width, uint16_t height, uint8_t *frame) {
+    if (!path || !frame) return -1;
+    FILE *f = fopen(path, "rb");
+    if (!f) return -1;
+    uint8_t hdr[HDR_LEN];
+    int rc = (fread(hdr, 1, HDR_LEN, f) == HDR_LEN && memcmp(hdr, SSD1306_STATE_MAGIC, 8) == 0) ? 0 : -1;
+    if (rc == 0 && ((hdr[8] | hdr[9] << 8) != width || (hdr[10] | hdr[11] << 8) != height)) rc = -2;
+    const size_t bytes = (size_t)width * (height / 8u);
+    if (rc == 0 && fread(frame, 1, bytes, f) != bytes) rc = -1;
+    fclose(f);
+    return rc;
+}
@@ -0,0 +1,192 @@
+// src/widget.c
+// Retained-mode widgets: repaint only what changed since the last frame.
+#include "widget.h"
+#include "gfx.h"
+#include <string.h>
+
+#define ROW_PX      8
+#define WHOLE_ROW   0x7FFF      // drawn_w after invalidate: erase the full row
+
+// ---------- Label ----------
+void widget_label_init(widget_label_t *w, int row, int align) {
+    if (!w) return;
+    w->row = row;
+    w->align = align;
+    w->text[0] = '\0';
+    widget_label_invalidate(w);
+}
+
+void widget_label_set(widget_label_t *w, const char *text) {
+    if (!w) return;
+    if (!text) text = "";
+    if (strncmp(w->text, text, sizeof(w->text) - 1) == 0) return;
+    strncpy(w->text, text, sizeof(w->text) - 1);
+    w->text[sizeof(w->text) - 1] = '\0';
+    w->dirty = true;
+}
+
+void widget_label_invalidate(widget_label_t *w) {
+    if (!w) return;
+    w->drawn_x = 0;
+    w->drawn_w = WHOLE_ROW;
+    w->dirty = true;
+}
+
+bool widget_label_draw(widget_label_t *w, gfx_surface_t *s) {
+    if (!w || !s || !w->dirty) return false;
+    const int y = w->row * ROW_PX;
+
+    // Erase what was painted last time (the full 8px band), then the new text
+    if (w->drawn_w > 0) gfx_fill_rect(s, w->drawn_x, y, w->drawn_w, ROW_PX, 0);
+    w->drawn_w = 0;
+    if (w->text[0]) {
+        const int x = gfx_align_x(s, w->text, w->align);
+        gfx_print_line(s, w->text, w->row, x);
+        w->drawn_x = x;
+        w->drawn_w = gfx_text_width(w->text);
+    }
+    w->dirty = false;
+    return true;
+}
+
+// ---------- Number ----------
+void widget_number_init(widget_number_t *w, int row, int align) {
+    if (!w) return;
+    widget_label_init(&w->label, row, align);
+    w->value = 0;
+    w->mode = DISP_HEX;
+    w->valid = false;
+}
+
+void widget_number_set(widget_number_t *w, uint64_t value, display_mode_t mode) {
+    if (!w) return;
+    if (w->valid && w->value == value && w->mode == mode) return;   // no reformat
+    w->value = value;
+    w->mode = mode;
+    w->valid = true;
+
+    char buf[CALC_DEC_LEN];
+    switch (mode) {
+        case DISP_HEX: calc_fmt_hex64(value, buf); break;
+        case DISP_DEC: calc_fmt_dec64(value, buf); break;
+        case DISP_BIN: calc_fmt_bin_tail16(value, buf); break;
+    }
+    widget_label_set(&w->label, buf);
+}
+
+void widget_number_invalidate(widget_number_t *w) {
+    if (w) widget_label_invalidate(&w->label);
+}
+
+bool widget_number_draw(widget_number_t *w, gfx_surface_t *s) {
+    return w ? widget_label_draw(&w->label, s) : false;
+}
+
+// ---------- Bit grid ----------
+int widget_bitgrid_init_geom(widget_bitgrid_t *w, int row0, const widget_bitgrid_geom_t *g) {
+    if (!w || !g) return -1;
+    if (g->bits == 0 || g->bits > 64 || g->cols == 0 || g->bits % g->cols) return -2;
+    if (g->box_w == 0 || g->box_w > WIDGET_BITGRID_BOX_MAX || g->box_w > g->cell_w) return -3;
+    if (g->box_h == 0 || g->box_h > ROW_PX || g->group == 0) return -4;
+
+    w->row0 = row0;
+    w->geom = *g;
+
+    // Box centred in its 8px row; hollow = full edge columns, top+bottom inside
+    const int margin_y = (ROW_PX - g->box_h) / 2;
+    const uint8_t col  = (uint8_t)(((1u << g->box_h) - 1u) << margin_y);
+    const uint8_t edge = (uint8_t)((1u << margin_y) | (1u << (margin_y + g->box_h - 1)));
+    for (int i = 0; i < g->box_w; ++i) {
+        w->filled[i] = col;
+        w->hollow[i] = (i == 0 || i == g->box_w - 1) ? col : edge;
+    }
+    w->box_mask = col;
+
+    w->value = w->drawn = 0;
+    w->valid = false;
+    widget_bitgrid_invalidate(w);
+    return 0;
+}
+
+void widget_bitgrid_init(widget_bitgrid_t *w, int row0) {
+    static const widget_bitgrid_geom_t GEOM_64 = WIDGET_BITGRID_GEOM_64;
+    widget_bitgrid_init_geom(w, row0, &GEOM_64);
+}
+
+void widget_bitgrid_set(widget_bitgrid_t *w, uint64_t value) {
+    if (!w) return;
+    if (w->geom.bits < 64) value &= (1ull << w->geom.bits) - 1u;
+    if (w->valid && w->value == value) return;
+    w->value = value;
+    w->valid = true;
+    w->dirty = true;
+}
+
+void widget_bitgrid_invalidate(widget_bitgrid_t *w) {
+    if (!w) return;
+    w->painted = false;
+    w->dirty = true;
+}
+
+static inline void touch(widget_bitgrid_t *w, int page, int x0, int x1) {
+    if (x0 < w->touched_x0[page]) w->touched_x0[page] = (uint8_t)x0;
+    if (x1 > w->touched_x1[page]) w->touched_x1[page] = (uint8_t)x1;
+}
+
+bool widget_bitgrid_draw(widget_bitgrid_t *w, gfx_surface_t *s) {
+    if (!w || !s || !s->buf || !w->dirty) return false;
+    w->dirty = false;
+    memset(w->touched_x0, 0xFF, sizeof(w->touched_x0));
+    memset(w->touched_x1, 0, sizeof(w->touched_x1));
+    if (w->row0 < 0) return false;
+
+    const widget_bitgrid_geom_t *g = &w->geom;
+    const int rows = g->bits / g->cols;
+    const int grid_w = g->cols * g->cell_w + ((g->cols - 1) / g->group) * g->gap;
+    const int start_x = ((int)s->width - grid_w) / 2 + (g->cell_w - g->box_w) / 2;
+    const int width = (int)s->width;
+    const int pages = s->pages < SSD1306_MAX_PAGES ? s->pages : SSD1306_MAX_PAGES;    // touched_x0/x1 size
+
+    uint64_t changed;
+    if (!w->painted) {
+        // Something else owned these rows: clear them and draw every cell
+        gfx_fill_rect(s, 0, w->row0 * ROW_PX, width, rows * ROW_PX, 0);
+        for (int r = 0; r < rows && w->row0 + r < pages; ++r) touch(w, w->row0 + r, 0, width - 1);
+        changed = (g->bits < 64) ? (1ull << g->bits) - 1u : ~0ull;
+    } else {
+        changed = w->drawn ^ w->value;
+    }
+
+    // Rewrite only the boxes whose bit flipped: box_w masked column-byte stores each,
+    // limited to the clip rectangle
+    const int xl = s->clip_x0, xe = s->clip_x1 + 1;
+    while (changed) {
+        const int b = __builtin_ctzll(changed);
+        changed &= changed - 1u;
+
+        const int k = g->bits - 1 - b;              // cell index, MSB first
+        const int r = k / g->cols, c = k % g->cols;
+        const int page = w->row0 + r;
+        if (page >= pages) continue;
+        const uint8_t m = (uint8_t)(w->box_mask & gfx_surface_clip_rows(s, page));
+
+        int x0 = start_x + c * g->cell_w + (c / g->group) * g->gap;
+        int i0 = 0, i1 = g->box_w;
+        if (x0 < xl) i0 = xl - x0;
+        if (x0 + i1 > xe) i1 = xe - x0;
+        if (i0 >= i1 || !m) continue;
+
+        const uint8_t *pat = ((w->value >> b) & 1u) ? w->filled : w->hollow;
+        const uint8_t keep = (uint8_t)~m;
+        uint8_t *p = &s->buf[(size_t)page * s->width + (size_t)(x0 + i0)];
+        pat += i0;
+        for (int i = 0; i < i1 - i0; ++i) p[i] = (uint8_t)((p[i] & keep) | (pat[i] & m));
+
+        gfx_surface_mark(s, page, x0 + i0, x0 + i1 - 1);
+        touch(w, page, x0 + i0, x0 + i1 - 1);
+    }
+
+    w->drawn = w->value;
+    w->painted = true;
+    return true;
+}
@@ -0,0 +1,328 @@
+// tools/bdf2c.c
+// Font compiler: converts a BDF bitmap font into a gfx_font_t atlas (C source
+// on stdout) with glyph columns in SSD1306 page order, per-glyph advance and
+// bearing, optional kerning pairs and optional pre-shifted column copies.
+//
+//   bdf2c [-n name] [-r first-last] [-s] [-k pairs.txt] font.bdf > font_name.c
+//     -n name         symbol is gfx_font_<name> (default: BDF file name)
+//     -r first-last   code range to include (default 32-126)
+//     -s              also emit the 7 pre-shifted copies (guarded by GFX_FONT_SHIFTED)
+//     -t              tight atlas: store ink columns only, never pad glyphs to their cell
+//     -k pairs.txt    kerning: one "<left> <right> <dx>" per line; left/right are
+//                     decimal codes or a quoted character such as 'A'
+//
+// The cell is FONT_ASCENT + FONT_DESCENT rows (FONTBOUNDINGBOX height if those
+// are missing); ink outside the cell is clipped with a warning.
+
+#include "gfx_font.h"
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CODES   256
+#define MAX_COLS    32          // widest glyph bounding box accepted (one uint32_t bitmap row)
+#define MAX_KERN    4096
+
+typedef struct {
+    bool     present;
+    int      advance;
+    int      bearing;           // first ink column relative to the pen
+    int      width;             // ink columns
+    uint32_t col[MAX_COLS];     // bit r = cell row r
+} glyph_t;
+
+static glyph_t     s_glyph[MAX_CODES];
+static gfx_kern_t  s_kern[MAX_KERN];
+static int         s_nkern;
+
+static void die(const char *msg, const char *arg) {
+    fprintf(stderr, "bdf2c: %s%s%s\n", msg, arg ? ": " : "", arg ? arg : "");
+    exit(1);
+}
+
+static bool starts(const char *line, const char *kw) {
+    const size_t n = strlen(kw);
+    return strncmp(line, kw, n) == 0 && (line[n] == ' ' || line[n] == '\n' || line[n] == '\r' || line[n] == '\0');
+}
+
+// ---------- BDF ----------
+typedef struct {
+    int ascent, descent;        // -1 until seen
+    int bbox_h, bbox_y;
+    int default_char;
+} font_info_t;
+
+static void read_bdf(FILE *in, font_info_t *fi) {
+    char line[512];
+    fi->ascent = fi->descent = -1;
+    fi->bbox_h = 0; fi->bbox_y = 0;
+    fi->default_char = -1;
+
+    // Glyphs are placed once the cell is known, so collect their bitmaps first
+    typedef struct { int code, dw, w, h, xo, yo; uint32_t rows[MAX_COLS]; } raw_t;
+    raw_t *raw = (raw_t *)calloc(MAX_CODES, sizeof(raw_t));
+    if (!raw) die("out of memory", NULL);
+    int nraw = 0;
+
+    int code = -1, dw = 0, w = 0, h = 0, xo = 0, yo = 0;
+    while (fgets(line, sizeof(line), in)) {
+        if (starts(line, "FONTBOUNDINGBOX")) {
+            int bw, bx;
+            sscanf(line + 15, "%d %d %d %d", &bw, &fi->bbox_h, &bx, &fi->bbox_y);
+        } else if (starts(line, "FONT_ASCENT")) {
+            fi->ascent = atoi(line + 11);
+        } else if (starts(line, "FONT_DESCENT")) {
+            fi->descent = atoi(line + 12);
+        } else if (starts(line, "DEFAULT_CHAR")) {
+            fi->default_char = atoi(line + 12);
+        } else if (starts(line, "STARTCHAR")) {
+            code = -1; dw = 0; w = h = xo = yo = 0;
+        } else if (starts(line, "ENCODING")) {
+            code = atoi(line + 8);
+        } else if (starts(line, "DWIDTH")) {
+            dw = atoi(line + 6);
+        } else if (starts(line, "BBX")) {
+            sscanf(line + 3, "%d %d %d %d", &w, &h, &xo, &yo);
+        } else if (starts(line, "BITMAP")) {
+            if (w > MAX_COLS || h > MAX_COLS) die("glyph bounding box too large", NULL);
+            raw_t *r = (code >= 0 && code < MAX_CODES) ? &raw[nraw] : NULL;
+            for (int y = 0; y < h; ++y) {
+                if (!fgets(line, sizeof(line), in)) die("truncated BITMAP", NULL);
+                if (!r) continue;
+                // Hex row, leftmost pixel = MSB of the first byte
+                uint64_t bits = strtoull(line, NULL, 16);
+                const int nbits = (int)(strspn(line, "0123456789abcdefABCDEF") * 4);
+                uint32_t row = 0;
+                for (int x = 0; x < w && x < nbits; ++x) {
+                    if ((bits >> (nbits - 1 - x)) & 1u) row |= 1u << x;
+                }
+                r->rows[y] = row;
+            }
+            if (r) {
+                r->code = code; r->dw = dw; r->w = w; r->h = h; r->xo = xo; r->yo = yo;
+                ++nraw;
+            }
+        }
+    }
+
+    if (fi->ascent < 0 || fi->descent < 0) {
+        fi->ascent = fi->bbox_h + fi->bbox_y;
+        fi->descent = -fi->bbox_y;
+    }
+    const int cell = fi->ascent + fi->descent;
+    if (cell <= 0 || cell > GFX_FONT_MAX_HEIGHT) die("cell height out of range (1..24 rows)", NULL);
+
+    for (int i = 0; i < nraw; ++i) {
+        const raw_t *r = &raw[i];
+        glyph_t *g = &s_glyph[r->code];
+        uint32_t col[2 * MAX_COLS] = {0};   // pen-relative columns, index x + MAX_COLS
+        int lo = 2 * MAX_COLS, hi = -1;
+        bool clipped = false;
+        for (int y = 0; y < r->h; ++y) {
+            const int cy = fi->ascent - (r->yo + r->h) + y;     // cell row of bitmap row y
+            for (int x = 0; x < r->w; ++x) {
+                if (!((r->rows[y] >> x) & 1u)) continue;
+                const int cx = r->xo + x + MAX_COLS;
+                if (cy < 0 || cy >= cell || cx < 0 || cx >= 2 * MAX_COLS) { clipped = true; continue; }
+                col[cx] |= 1u << cy;
+                if (cx < lo) lo = cx;
+                if (cx > hi) hi = cx;
+            }
+        }
+        if (clipped) fprintf(stderr, "bdf2c: warning: glyph %d has ink outside the cell (clipped)\n", r->code);
+
+        g->present = true;
+        g->advance = r->dw;
+        if (hi < lo) { g->width = 0; g->bearing = 0; continue; }
+        if (hi - lo + 1 > MAX_COLS) die("glyph too wide", NULL);
+        g->bearing = lo - MAX_COLS;
+        g->width = hi - lo + 1;
+        for (int x = 0; x < g->width; ++x) g->col[x] = col[lo + x];
+    }
+    free(raw);
+}
+
+// ---------- Kerning pairs ----------
+static int parse_code(const char *t) {
+    if (t[0] == '\'' && t[1] && t[2] == '\'') return (unsigned char)t[1];
+    char *end;
+    long v = strtol(t, &end, 0);
+    return (*end || v < 0 || v >= MAX_CODES) ? -1 : (int)v;
+}
+
+static int cmp_kern(const void *a, const void *b) {
+    return (int)((const gfx_kern_t *)a)->pair - (int)((const gfx_kern_t *)b)->pair;
+}
+
+static void read_kern(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) die("cannot open kerning file", path);
+    char line[256], l[32], r[32];
+    int dx, n = 0;
+    while (fgets(line, sizeof(line), f)) {
+        ++n;
+        const char *p = line;
+        while (isspace((unsigned char)*p)) ++p;
+        if (*p == '#' || *p == '\0') continue;
+        if (sscanf(p, "%31s %31s %d", l, r, &dx) != 3) { fprintf(stderr, "bdf2c: %s:%d: expected <left> <right> <dx>\n", path, n); exit(1); }
+        const int a = parse_code(l), b = parse_code(r);
+        if (a < 0 || b < 0 || dx < -128 || dx > 127) { fprintf(stderr, "bdf2c: %s:%d: bad pair\n", path, n); exit(1); }
+        if (dx == 0) continue;
+        if (s_nkern == MAX_KERN) die("too many kerning pairs", NULL);
+        s_kern[s_nkern++] = (gfx_kern_t){ .pair = (uint16_t)(a << 8 | b), .dx = (int8_t)dx };
+    }
+    fclose(f);
+    qsort(s_kern, (size_t)s_nkern, sizeof(s_kern[0]), cmp_kern);
+}
+
+// ---------- Output ----------
+static void emit_bytes(const char *name, const uint8_t *b, size_t n) {
+    printf("static const uint8_t %s[%zu] = {", name, n ? n : 1);
+    for (size_t i = 0; i < n; ++i) printf("%s0x%02X,", (i % 16) ? "" : "\n    ", b[i]);
+    if (!n) printf("0");
+    printf("\n};\n\n");
+}
+
+int main(int argc, char **argv) {
+    const char *name = NULL, *kern_path = NULL, *path = NULL;
+    int first = 32, last = 126;
+    bool shifted = false, tight = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) name = argv[++i];
+        else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) kern_path = argv[++i];
+        else if (strcmp(argv[i], "-s") == 0) shifted = true;
+        else if (strcmp(argv[i], "-t") == 0) tight = true;
+        else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%d-%d", &first, &last) != 2) die("bad range", argv[i]);
+        }
+        else if (argv[i][0] != '-' && !path) path = argv[i];
+        else die("usage: bdf2c [-n name] [-r first-last] [-s] [-t] [-k pairs.txt] font.bdf", NULL);
+    }
+    if (!path) die("usage: bdf2c [-n name] [-r first-last] [-s] [-t] [-k pairs.txt] font.bdf", NULL);
+    if (first < 0 || last >= MAX_CODES || first > last) die("range must be within 0-255", NULL);
+    // gfx_font_t.count is a uint8_t: at most 255 codes per atlas
+    if (last - first + 1 > 255) die("range must span at most 255 codes", NULL);
+
+    // Default symbol name: file name without directory and extension
+    char base[64];
+    if (!name) {
+        const char *b = strrchr(path, '/');
+        b = b ? b + 1 : path;
+        size_t n = strcspn(b, ".");
+        if (n >= sizeof(base)) n = sizeof(base) - 1;
+        for (size_t i = 0; i < n; ++i) base[i] = isalnum((unsigned char)b[i]) ? b[i] : '_';
+        base[n] = '\0';
+        name = base;
+    }
+
+    FILE *in = fopen(path, "r");
+    if (!in) die("cannot open", path);
+    font_info_t fi;
+    read_bdf(in, &fi);
+    fclose(in);
+    if (kern_path) read_kern(kern_path);
+
+    const int count = last - first + 1;
+    const int height = fi.ascent + fi.descent;
+    const int pages = (height + 7) / 8;
+    int def = fi.default_char;
+    if (def < first || def > last || !s_glyph[def].present) def = ('?' >= first && '?' <= last && s_glyph['?'].present) ? '?' : first;
+
+    // When every glyph's ink lies within its advance, gfx can draw the font one
+    // cell at a time. Unless -t, such glyphs are then stored padded to the full
+    // cell (bearing 0, width = advance), so a cell is one straight column copy.
+    // A cell wider than MAX_COLS cannot be padded, so such a font stays tight.
+    bool in_cell = true;
+    for (int c = first; c <= last; ++c) {
+        const glyph_t *g = &s_glyph[c];
+        if (!g->present) continue;
+        if (g->advance > MAX_COLS) in_cell = false;
+        if (g->width && (g->bearing < 0 || g->bearing + g->width > g->advance)) in_cell = false;
+    }
+    for (int c = first; c <= last && in_cell && !tight; ++c) {
+        glyph_t *g = &s_glyph[c];
+        if (!g->present) continue;
+        uint32_t col[MAX_COLS] = {0};
+        for (int x = 0; x < g->width; ++x) col[g->bearing + x] = g->col[x];
+        memcpy(g->col, col, sizeof(col));
+        g->bearing = 0;
+        g->width = g->advance;
+    }
+
+    // Column atlas; missing codes share the default glyph's columns
+    size_t total = 0;
+    for (int c = first; c <= last; ++c) if (s_glyph[c].present) total += (size_t)s_glyph[c].width;
+    if (total > 0xFFFF) die("atlas too large", NULL);
+    uint8_t *cols = (uint8_t *)calloc(total * (size_t)pages + 1, 1);
+    uint8_t *shift[8] = {0};
+    for (int s = 1; s < 8 && shifted; ++s) shift[s] = (uint8_t *)calloc(total * (size_t)(pages + 1) + 1, 1);
+    gfx_glyph_t *meta = (gfx_glyph_t *)calloc((size_t)count, sizeof(*meta));
+    if (!cols || !meta) die("out of memory", NULL);
+
+    size_t at = 0;
+    for (int c = first; c <= last; ++c) {
+        const glyph_t *g = &s_glyph[c];
+        if (!g->present) continue;
+        meta[c - first] = (gfx_glyph_t){ .offset = (uint16_t)at, .width = (uint8_t)g->width,
+                                         .advance = (uint8_t)g->advance, .bearing = (int8_t)g->bearing };
+        for (int x = 0; x < g->width; ++x, ++at) {
+            for (int k = 0; k < pages; ++k) cols[at * (size_t)pages + (size_t)k] = (uint8_t)(g->col[x] >> (8 * k));
+            for (int s = 1; s < 8 && shifted; ++s) {
+                const uint32_t v = g->col[x] << s;
+                for (int k = 0; k <= pages; ++k) shift[s][at * (size_t)(pages + 1) + (size_t)k] = (uint8_t)(v >> (8 * k));
+            }
+        }
+    }
+    for (int c = first; c <= last; ++c) if (!s_glyph[c].present) meta[c - first] = meta[def - first];
+
+    printf("// Generated by tools/bdf2c from %s -- do not edit; rerun `make fonts`.\n", path);
+    printf("#include \"gfx_font.h\"\n\n");
+    emit_bytes("COLS", cols, total * (size_t)pages);
+    if (shifted) {
+        printf("#if GFX_FONT_SHIFTED\n");
+        for (int s = 1; s < 8; ++s) {
+            char sym[16];
+            snprintf(sym, sizeof(sym), "SHIFT%d", s);
+            emit_bytes(sym, shift[s], total * (size_t)(pages + 1));
+        }
+        printf("#endif\n\n");
+    }
+
+    printf("static const gfx_glyph_t GLYPHS[%d] = {\n", count);
+    for (int i = 0; i < count; ++i) {
+        printf("    { %5u, %2u, %2u, %3d },   // ", meta[i].offset, meta[i].width, meta[i].advance, meta[i].bearing);
+        const int c = first + i;
+        if (c > 32 && c < 127 && c != '\\') printf("'%c'\n", c); else printf("%d\n", c);
+    }
+    printf("};\n\n");
+
+    if (s_nkern) {
+        printf("static const gfx_kern_t KERN[%d] = {\n", s_nkern);
+        for (int i = 0; i < s_nkern; ++i) printf("    { 0x%04X, %d },\n", s_kern[i].pair, s_kern[i].dx);
+        printf("};\n\n");
+    }
+
+    printf("const gfx_font_t gfx_font_%s = {\n", name);
+    printf("    .first = %d, .count = %d, .default_char = %d,\n", first, count, def);
+    printf("    .height = %d, .pages = %d, .line_height = %d,\n", height, pages, pages * 8);
+    if (in_cell && !tight) printf("    .flags = GFX_FONT_CELLS,\n");
+    printf("    .glyphs = GLYPHS,\n");
+    printf("    .cols = COLS,\n");
+    if (shifted) {
+        printf("#if GFX_FONT_SHIFTED\n");
+        printf("    .shifted = { NULL, SHIFT1, SHIFT2, SHIFT3, SHIFT4, SHIFT5, SHIFT6, SHIFT7 },\n");
+        printf("#endif\n");
+    }
+    if (s_nkern) printf("    .kern = KERN, .nkern = %d,\n", s_nkern);
+    printf("};\n");
+
+    for (int s = 1; s < 8; ++s) free(shift[s]);
+    free(cols);
+    free(meta);
+    return 0;
+}
@@ -0,0 +1,323 @@
+// tools/bench.c
+// Host microbenchmarks for the gfx, driver and calculator hot paths.
+// Runs against the simulated port (no hardware) and prints one JSON object
+// per benchmark on stdout:
+//   {"bench":"...","iters":N,"ns_per_op":X[,"fps":F,"bus_bytes_per_frame":B,"bus_us_400k":T]}
+
+#define _POSIX_C_SOURCE 200809L   // clock_gettime
+#include "app_calc.h"
+#include "calc.h"
+#include "calc_prog.h"
+#include "gfx.h"
+#include "port.h"
+#include "port_sim.h"
+#include "ssd1306.h"
+#include "ssd1306_async.h"
+#include "widget.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef BENCH_MIN_NS
+#define BENCH_MIN_NS  200000000ull   // run each benchmark for at least 200 ms
+#endif
+
+static volatile uint64_t s_sink;      // keeps results observable to the compiler
+static port_t            *s_port;
+static ssd1306_t          s_dev;
+static const char        *s_filter;   // optional substring filter from argv[1]
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+typedef void (*bench_fn)(uint64_t i);
+
+// Time fn(i) for i = 0.. until BENCH_MIN_NS elapsed, doubling the batch size.
+// 'frames' marks benchmarks where one op is one display frame; those also
+// report bus traffic measured by the simulated port.
+static void run(const char *name, bench_fn fn, int frames) {
+    if (s_filter && !strstr(name, s_filter)) return;
+
+    for (uint64_t i = 0; i < 16; ++i) fn(i);     // warm-up
+    port_sim_reset_stats(s_port);
+
+    uint64_t iters = 0, batch = 64, elapsed = 0;
+    while (elapsed < BENCH_MIN_NS) {
+        const uint64_t t0 = now_ns();
+        for (uint64_t i = 0; i < batch; ++i) fn(iters + i);
+        elapsed += now_ns() - t0;
+        iters += batch;
+        if (batch < (1ull << 24)) batch *= 2;
+    }
+
+    const double ns = (double)elapsed / (double)iters;
+    printf("{\"bench\":\"%s\",\"iters\":%llu,\"ns_per_op\":%.2f", name, (unsigned long long)iters, ns);
+    if (frames) {
+        const port_sim_stats_t *st = port_sim_stats(s_port);
+        printf(",\"fps\":%.1f,\"bus_bytes_per_frame\":%.1f,\"bus_us_400k\":%.1f",
+               1e9 / ns,
+               (double)port_sim_wire_bytes(st) / (double)iters,
+               port_sim_bus_time_us(st, 400000) / (double)iters);
+    }
+    printf("}\n");
+    fflush(stdout);
+}
+
+// ---------- gfx ----------
+static void b_set_pixel(uint64_t i) {
+    const int x = (int)(i & 127), y = (int)((i >> 7) & 63);
+    gfx_set_pixel(&s_dev.surface, x, y, (int)((i >> 13) & 1));
+}
+
+static void b_draw_char(uint64_t i) {
+    gfx_draw_char(&s_dev.surface, (int)(i % 120), (int)(i % 7) * 8, (char)(32 + i % 95));
+}
+
+static const char TEXT21[] = "0x0123_4567_89AB_CDEF";
+
+static void b_draw_text_aligned(uint64_t i) {
+    gfx_draw_text(&s_dev.surface, 0, (int)(i & 7) * 8, TEXT21);
+}
+
+static void b_draw_text_unaligned(uint64_t i) {
+    gfx_draw_text(&s_dev.surface, 0, (int)(i & 7) * 7 + 3, TEXT21);
+}
+
+static void b_print_line(uint64_t i) {
+    gfx_print_line(&s_dev.surface, "OPERATION: subtract", (int)(i & 7), GFX_ALIGN_CENTER);
+}
+
+static void b_fill_rect_full(uint64_t i) {
+    gfx_fill_rect(&s_dev.surface, 0, 0, s_dev.width, s_dev.height, (int)(i & 1));
+}
+
+static void b_fill_rect_box(uint64_t i) {
+    gfx_fill_rect(&s_dev.surface, (int)(i % 120), (int)(i % 56) + 1, 5, 5, 1);
+}
+
+static void b_draw_rect_box(uint64_t i) {
+    gfx_draw_rect(&s_dev.surface, (int)(i % 120), (int)(i % 56) + 1, 5, 5, 1);
+}
+
+// Off-screen 128x32 chrome: four text rows rendered once, then copied
+static uint8_t       s_chrome_buf[128 * 4];
+static gfx_surface_t s_chrome;
+
+static void chrome_init(void) {
+    gfx_surface_init(&s_chrome, s_chrome_buf, 128, 32);
+    for (int r = 0; r < 4; ++r) gfx_print_line(&s_chrome, TEXT21, r, GFX_ALIGN_LEFT);
+}
+
+static void b_copy_aligned(uint64_t i) {
+    gfx_copy(&s_dev.surface, 0, (int)(i & 1) * 32, &s_chrome, 0, 0, 128, 32, GFX_ROP_COPY);
+}
+
+static void b_copy_shifted(uint64_t i) {
+    gfx_copy(&s_dev.surface, 0, (int)(i % 29) + 1, &s_chrome, 0, 0, 128, 32, GFX_ROP_OR);
+}
+
+// 16x16 icon (ring with a dot), page-major like the framebuffer
+static const uint8_t ICON16[32] = {
+    0xE0, 0x18, 0x04, 0x02, 0x02, 0x01, 0x81, 0xC1, 0xC1, 0x81, 0x01, 0x02, 0x02, 0x04, 0x18, 0xE0,
+    0x07, 0x18, 0x20, 0x40, 0x40, 0x80, 0x81, 0x83, 0x83, 0x81, 0x80, 0x40, 0x40, 0x20, 0x18, 0x07,
+};
+static const gfx_bitmap_t s_icon = { 16, 16, ICON16 };
+
+static void b_blit_icon(uint64_t i) {
+    gfx_blit(&s_dev.surface, (int)(i % 112), (int)(i % 48), &s_icon, (i & 1) ? GFX_ROP_XOR : GFX_ROP_OR);
+}
+
+static void b_line_shallow(uint64_t i) {
+    gfx_draw_line(&s_dev.surface, 0, (int)(i & 63), 127, 63 - (int)(i & 63), (int)(i & 1));
+}
+
+static void b_line_steep(uint64_t i) {
+    gfx_draw_line(&s_dev.surface, (int)(i & 127), 0, 127 - (int)(i & 127), 63, (int)(i & 1));
+}
+
+static void b_circle(uint64_t i) {
+    gfx_draw_circle(&s_dev.surface, 64, 32, 8 + (int)(i % 24), (int)(i & 1));
+}
+
+static void b_fill_circle(uint64_t i) {
+    gfx_fill_circle(&s_dev.surface, 64, 32, 8 + (int)(i % 24), (int)(i & 1));
+}
+
+static widget_bitgrid_t s_grid;
+
+static void b_bitgrid64(uint64_t i) {
+    widget_bitgrid_set(&s_grid, i * 0x9E3779B97F4A7C15ull);
+    widget_bitgrid_draw(&s_grid, &s_dev.surface);
+}
+
+static void b_bitgrid64_inc(uint64_t i) {
+    // Counting: on average two cells flip per step
+    widget_bitgrid_set(&s_grid, i);
+    widget_bitgrid_draw(&s_grid, &s_dev.surface);
+}
+
+static void b_bitgrid64_full(uint64_t i) {
+    widget_bitgrid_set(&s_grid, i * 0x9E3779B97F4A7C15ull);
+    widget_bitgrid_invalidate(&s_grid);
+    widget_bitgrid_draw(&s_grid, &s_dev.surface);
+}
+
+// ---------- Driver ----------
+static void b_update_full(uint64_t i) {
+    s_dev.buffer[i % 1024u] ^= 1;
+    ssd1306_update_full(&s_dev);
+}
+
+// ---------- Calculator ----------
+static app_calc_screen_t s_screen;
+
+static void b_render_calc(uint64_t i) {
+    // Typical keystroke: value changes by a small step, OPERATION stays up
+    calc_t c;
+    calc_init(&c);
+    c.input_line[0] = '1'; c.input_line[1] = '\0';
+    c.show_op = true; c.op_name = "add";
+    c.result = 0x1000 + i;
+    app_calc_render(&s_dev, &s_screen, &c);
+}
+
+static const char *const NUMS[] = {
+    "0x0123_4567_89AB_CDEF", "0xdeadbeef", "0b1010_1111_0000_0101",
+    "18446744073709551615", "0d42", "1234",
+};
+
+static void b_parse_num64(uint64_t i) {
+    uint64_t v = 0;
+    calc_parse_num64(NUMS[i % 6], &v);
+    s_sink += v;
+}
+
+// Token stream typical of scripted input: load, binary ops, unary op, display
+static const char *const SCRIPT[] = {
+    "0x1000", "+", "5", "<<", "2", "xor", "0b1010_1010", "invert", "-", "1234", "hex",
+};
+static calc_t s_calc;
+
+static void b_calc_feed(uint64_t i) {
+    calc_feed(&s_calc, SCRIPT[i % 11]);
+    s_sink += s_calc.result;
+}
+
+static const char *const OPS[] = { "+", "xor", "<<", "invert", "BIN", "subtract", "0x10" };
+
+static void b_parse_operator(uint64_t i) {
+    s_sink += (uint64_t)calc_parse_operator(OPS[i % 7]);
+}
+
+// Map mode kernel: one op = the SCRIPT-like chain over 4096 values
+#define MAP_N  4096
+static calc_prog_t s_prog;
+static uint64_t    s_map[MAP_N];
+
+static void b_calc_prog_run(uint64_t i) {
+    s_map[i % MAP_N] = i;
+    calc_prog_run(&s_prog, s_map, s_map, MAP_N);
+    s_sink += s_map[0];
+}
+
+// ---------- Multi-panel flushing ----------
+// 'panels' panels spread over 'buses' buses, each flushed by its bus thread,
+// with the simulated bus clocked at 1 MHz. One op = a full new frame on every
+// panel, submitted together and waited for; reports aggregate panel fps.
+#define BENCH_MAX_PANELS  4
+#define BENCH_BUS_HZ      1000000u
+
+static void run_panels(const char *name, int panels, int buses) {
+    if (s_filter && !strstr(name, s_filter)) return;
+
+    port_t   *port[BENCH_MAX_PANELS] = {0};
+    ssd1306_t dev[BENCH_MAX_PANELS];
+    memset(dev, 0, sizeof(dev));
+    for (int i = 0; i < panels; ++i) {
+        const port_display_cfg_t cfg = { .i2c_addr = (uint8_t)(0x3C + (i & 1)), .width = 128, .height = 64,
+                                         .i2c_bus = (uint8_t)(1 + i % buses) };
+        if (port_open(&cfg, &port[i]) != 0 || ssd1306_init(&dev[i], port[i]) != 0) return;
+        ssd1306_update_full(&dev[i]);
+        ssd1306_async_start(&dev[i]);
+    }
+    port_sim_set_bus_clock(BENCH_BUS_HZ);
+
+    uint64_t iters = 0, elapsed = 0;
+    while (elapsed < BENCH_MIN_NS) {
+        const uint64_t t0 = now_ns();
+        int64_t seq[BENCH_MAX_PANELS];
+        for (int i = 0; i < panels; ++i) {
+            memset(dev[i].buffer, (iters & 1) ? 0x55 : 0xAA, 1024);
+            ssd1306_mark_all_dirty(&dev[i]);
+            seq[i] = ssd1306_submit(&dev[i]);
+        }
+        for (int i = 0; i < panels; ++i) ssd1306_wait_frame(&dev[i], seq[i]);
+        elapsed += now_ns() - t0;
+        ++iters;
+    }
+
+    port_sim_set_bus_clock(0);
+    for (int i = 0; i < panels; ++i) {
+        ssd1306_async_stop(&dev[i]);
+        ssd1306_deinit(&dev[i]);
+        port_close(port[i]);
+    }
+
+    const double ns = (double)elapsed / (double)iters;
+    printf("{\"bench\":\"%s\",\"iters\":%llu,\"ns_per_op\":%.2f,\"panels\":%d,\"buses\":%d,\"aggregate_fps\":%.1f}\n",
+           name, (unsigned long long)iters, ns, panels, buses, (double)panels * 1e9 / ns);
+    fflush(stdout);
+}
+
+int main(int argc, char **argv) {
+    s_filter = (argc > 1) ? argv[1] : NULL;
+
+    const port_display_cfg_t cfg = { .i2c_addr = 0x3C, .width = 128, .height = 64 };
+    if (port_open(&cfg, &s_port) != 0) return 1;
+    if (ssd1306_init(&s_dev, s_port) != 0) { port_close(s_port); return 2; }
+    ssd1306_update_full(&s_dev);
+
+    run("gfx_set_pixel",           b_set_pixel, 0);
+    run("gfx_draw_char",           b_draw_char, 0);
+    run("gfx_draw_text/aligned",   b_draw_text_aligned, 0);
+    run("gfx_draw_text/unaligned", b_draw_text_unaligned, 0);
+    run("gfx_print_line",          b_print_line, 0);
+    run("gfx_fill_rect/full",      b_fill_rect_full, 0);
+    run("gfx_fill_rect/5x5",       b_fill_rect_box, 0);
+    run("gfx_draw_rect/5x5",       b_draw_rect_box, 0);
+    chrome_init();
+    run("gfx_copy/128x32/aligned", b_copy_aligned, 0);
+    run("gfx_copy/128x32/shifted", b_copy_shifted, 0);
+    run("gfx_blit/16x16",          b_blit_icon, 0);
+    run("gfx_draw_line/shallow",   b_line_shallow, 0);
+    run("gfx_draw_line/steep",     b_line_steep, 0);
+    run("gfx_draw_circle/r8-31",   b_circle, 0);
+    run("gfx_fill_circle/r8-31",   b_fill_circle, 0);
+    widget_bitgrid_init(&s_grid, gfx_text_rows(&s_dev.surface) - 4);
+    run("draw_bitgrid64",          b_bitgrid64, 0);
+    run("draw_bitgrid64/inc",      b_bitgrid64_inc, 0);
+    run("draw_bitgrid64/full",     b_bitgrid64_full, 0);
+    ssd1306_update_full(&s_dev);
+    run("ssd1306_update_full",     b_update_full, 1);
+    app_calc_screen_init(&s_screen, &s_dev);
+    run("render_calc",             b_render_calc, 1);
+    run("calc_parse_num64",        b_parse_num64, 0);
+    run("calc_parse_operator",     b_parse_operator, 0);
+    calc_init(&s_calc);
+    run("calc_feed",               b_calc_feed, 0);
+    static const char MAP_EXPR[] = "+ 5 << 2 xor 0b1010_1010 invert - 1234";
+    calc_prog_compile(&s_prog, MAP_EXPR, sizeof(MAP_EXPR) - 1, NULL);
+    run("calc_prog_run/4096",      b_calc_prog_run, 0);
+    run_panels("async_panels/4x1bus",  4, 1);
+    run_panels("async_panels/4x2bus",  4, 2);
+    run_panels("async_panels/4x4bus",  4, 4);
+
+    ssd1306_deinit(&s_dev);
+    port_close(s_port);
+    return 0;
+}
@@ -0,0 +1,487 @@
+// tools/render.c
+// Headless renderer: runs the hello screen and calculator token scripts
+// against the simulated port and writes every frame as a PBM image, or
+// compares the frames against PBMs written by an earlier run. Prints one JSON
+// summary:
+//   {"frames":N,"written":W,"checked":C,"mismatches":M}
+//
+//   oled_render [--out DIR] [--check DIR] [--hello] [--gfx] [script.txt ...]
+//
+// Each line of a script is fed to the calculator like one line typed in
+// interactive mode and produces one frame, <script>-NNN.pbm (frame 000 is the
+// screen before the first line). --hello adds hello-000.pbm. --gfx adds the
+// gfx-NNN.pbm test cards of the surface primitives and checks those
+// primitives on random clipped, unaligned surfaces against per-pixel
+// reference loops, one check per case. With --check a
+// missing or differing golden image fails the run (exit 1); with --out as
+// well, the frames are written there for inspection. Every frame is also
+// checked against the emulated panel RAM, so a flush that loses or misplaces
+// bytes fails like a drawing bug.
+//
+// Images are P4 PBM, decoded from the page-major buffer: 1 (black) = lit pixel.
+
+#define _POSIX_C_SOURCE 200809L   // strdup
+#include "app_calc.h"
+#include "app_render_hello.h"
+#include "calc.h"
+#include "gfx.h"
+#include "port.h"
+#include "port_sim.h"
+#include "ssd1306.h"
+#include "ssd1306_async.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ROW_MAX  (128 / 8)           // PBM bytes per row at the widest panel
+
+typedef struct {
+    const char *out_dir, *check_dir;
+    uint64_t    frames, written, checked, mismatches;
+} render_run_t;
+
+// Pack row y of the page-major buffer into PBM bits (MSB = leftmost pixel).
+static void pbm_row(const ssd1306_t *dev, int y, uint8_t *row) {
+    const int W = SSD1306_WIDTH(dev);
+    const uint8_t *page = &dev->buffer[(size_t)(y >> 3) * W];
+    memset(row, 0, (size_t)(W + 7) / 8);
+    for (int x = 0; x < W; ++x)
+        if ((page[x] >> (y & 7)) & 1u) row[x >> 3] |= (uint8_t)(0x80u >> (x & 7));
+}
+
+static int pbm_write(const ssd1306_t *dev, const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return -1;
+    const int W = SSD1306_WIDTH(dev), H = SSD1306_HEIGHT(dev);
+    fprintf(f, "P4\n%d %d\n", W, H);
+    uint8_t row[ROW_MAX];
+    for (int y = 0; y < H; ++y) {
+        pbm_row(dev, y, row);
+        fwrite(row, 1, (size_t)(W + 7) / 8, f);
+    }
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+// Next header number of a PBM, skipping whitespace and '#' comments.
+static int pbm_number(FILE *f) {
+    int c;
+    for (;;) {
+        c = fgetc(f);
+        if (c == '#') { while (c != '\n' && c != EOF) c = fgetc(f); }
+        else if (c != ' ' && c != '\t' && c != '\r' && c != '\n') break;
+    }
+    int v = -1;
+    while (c >= '0' && c <= '9') { v = (v < 0 ? 0 : v * 10) + (c - '0'); c = fgetc(f); }
+    return v;   // the single whitespace after the number has been consumed
+}
+
+// Compare the frame with a golden PBM. Returns 0 when equal, 1 when the
+// pixels differ (first difference in *dx, *dy), -1 when missing or not a
+// PBM of the panel's size.
+static int pbm_compare(const ssd1306_t *dev, const char *path, int *dx, int *dy) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return -1;
+    const int W = SSD1306_WIDTH(dev), H = SSD1306_HEIGHT(dev);
+    const size_t rb = (size_t)(W + 7) / 8;
+    int rc = (fgetc(f) == 'P' && fgetc(f) == '4' && pbm_number(f) == W && pbm_number(f) == H) ? 0 : -1;
+    uint8_t want[ROW_MAX], have[ROW_MAX];
+    for (int y = 0; y < H && rc == 0; ++y) {
+        if (fread(want, 1, rb, f) != rb) { rc = -1; break; }
+        pbm_row(dev, y, have);
+        if (W & 7) want[rb - 1] &= (uint8_t)(0xFF00u >> (W & 7));   // padding bits are unspecified
+        if (memcmp(want, have, rb) == 0) continue;
+        int x = 0;
+        while (((want[x >> 3] ^ have[x >> 3]) & (0x80u >> (x & 7))) == 0) ++x;
+        *dx = x; *dy = y;
+        rc = 1;
+    }
+    fclose(f);
+    return rc;
+}
+
+static void frame(render_run_t *run, const ssd1306_t *dev, const port_t *port, const char *name, int n) {
+    char file[256], path[4096];
+    snprintf(file, sizeof(file), "%s-%03d.pbm", name, n);
+    run->frames++;
+
+    const long at = port_sim_compare(port, dev->buffer, (uint16_t)SSD1306_WIDTH(dev), (uint8_t)SSD1306_PAGES(dev));
+    if (at >= 0) {
+        fprintf(stderr, "%s: panel RAM differs from the framebuffer at byte %ld (page %ld, x %ld)\n",
+                file, at, at / SSD1306_WIDTH(dev), at % SSD1306_WIDTH(dev));
+        run->mismatches++;
+    }
+    if (run->check_dir) {
+        int x = 0, y = 0;
+        snprintf(path, sizeof(path), "%s/%s", run->check_dir, file);
+        const int rc = pbm_compare(dev, path, &x, &y);
+        if (rc < 0)      fprintf(stderr, "%s: no golden image of this panel size\n", path);
+        else if (rc > 0) fprintf(stderr, "%s: first differing pixel at x=%d y=%d\n", path, x, y);
+        if (rc != 0) run->mismatches++;
+        run->checked++;
+    }
+    if (run->out_dir) {
+        snprintf(path, sizeof(path), "%s/%s", run->out_dir, file);
+        if (pbm_write(dev, path) < 0) { perror(path); run->mismatches++; }
+        else run->written++;
+    }
+}
+
+// Frame name of a script: its file name without directory and extension.
+static char *script_name(const char *path) {
+    const char *base = strrchr(path, '/');
+    char *name = strdup(base ? base + 1 : path);
+    char *dot = name ? strrchr(name, '.') : NULL;
+    if (dot && dot != name) *dot = '\0';
+    return name;
+}
+
+static int run_script(render_run_t *run, ssd1306_t *dev, const port_t *port, const char *path) {
+    FILE *in = fopen(path, "r");
+    char *name = script_name(path);
+    if (!in || !name) { perror(path); if (in) fclose(in); free(name); return -1; }
+
+    calc_t calc;
+    calc_init(&calc);
+    app_calc_screen_t screen;
+    app_calc_screen_init(&screen, dev);
+    ssd1306_clear(dev);
+    app_calc_render(dev, &screen, &calc);
+    int n = 0;
+    frame(run, dev, port, name, n++);
+
+    // One frame per line, as in interactive mode; a line without a valid
+    // token still yields a frame, so frame numbers follow the script lines.
+    char line[1024];
+    while (fgets(line, sizeof(line), in)) {
+        const char *pos = line, *end = line + strlen(line), *tok;
+        size_t len;
+        bool quit = false;
+        while ((len = calc_next_token(&pos, end, &tok)) != 0)
+            if (calc_feed_n(&calc, tok, len) == CALC_QUIT) { quit = true; break; }
+        if (quit) break;
+        app_calc_render(dev, &screen, &calc);
+        frame(run, dev, port, name, n++);
+    }
+    fclose(in);
+    free(name);
+    return 0;
+}
+
+// ---------- Surface primitives (--gfx) ----------
+// Each case draws on a random surface (any size up to the panel's, noise
+// inside, a random or the full clip) with the optimised primitive, and on a
+// copy of it with a per-pixel loop; the buffers must be equal and every
+// changed byte must lie in the page's dirty span.
+
+#define GFX_CASES  2000              // random cases per primitive
+#define GFX_BUF    (128 * 8)         // bytes of the largest checked surface
+
+static uint32_t s_rng = 0x9E3779B9u;
+
+static int rnd(int lo, int hi) {     // xorshift32, uniform enough for test inputs
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return lo + (int)(s_rng % (uint32_t)(hi - lo + 1));
+}
+
+static int px_get(const uint8_t *buf, int w, int x, int y) {
+    return (buf[(size_t)(y >> 3) * (size_t)w + (size_t)x] >> (y & 7)) & 1;
+}
+
+// Reference plot: one pixel of 'want', the expected buffer of 's', clipped like gfx.
+static void ref_put(const gfx_surface_t *s, uint8_t *want, int x, int y, int on) {
+    if (x < s->clip_x0 || x > s->clip_x1 || y < s->clip_y0 || y > s->clip_y1) return;
+    uint8_t *b = &want[(size_t)(y >> 3) * s->width + (size_t)x];
+    *b = on ? (uint8_t)(*b | 1u << (y & 7)) : (uint8_t)(*b & ~(1u << (y & 7)));
+}
+
+static int ref_rop(gfx_rop_t rop, int d, int v) {
+    switch (rop) {
+    case GFX_ROP_OR:  return d | v;
+    case GFX_ROP_AND: return d & v;
+    case GFX_ROP_XOR: return d ^ v;
+    default:          return v;
+    }
+}
+
+typedef struct {
+    gfx_surface_t s;
+    uint8_t       buf[GFX_BUF];      // drawn by gfx
+    uint8_t       want[GFX_BUF];     // drawn by the reference loop
+    uint8_t       orig[GFX_BUF];     // before either
+    uint8_t       dirty_x0[SSD1306_MAX_PAGES], dirty_x1[SSD1306_MAX_PAGES];
+} gfx_case_t;
+
+// A surface of random size (or the panel's, so fixed-geometry builds take
+// their constant-folded path) filled with noise, a random clip, clean spans.
+static void case_init(gfx_case_t *c, int pw, int ph) {
+    const bool panel = rnd(0, 3) == 0;
+    gfx_surface_init(&c->s, c->buf, panel ? pw : rnd(1, pw), panel ? ph : rnd(1, ph));
+    const size_t bytes = (size_t)c->s.width * c->s.pages;
+    for (size_t i = 0; i < bytes; ++i) c->buf[i] = (uint8_t)rnd(0, 255);
+    if (rnd(0, 2))
+        gfx_set_clip(&c->s, rnd(-8, c->s.width), rnd(-8, c->s.height),
+                     rnd(0, c->s.width + 8), rnd(0, c->s.height + 8));
+    memset(c->dirty_x0, 0xFF, sizeof(c->dirty_x0));
+    memset(c->dirty_x1, 0x00, sizeof(c->dirty_x1));
+    c->s.dirty_x0 = c->dirty_x0;
+    c->s.dirty_x1 = c->dirty_x1;
+    memcpy(c->want, c->buf, bytes);
+    memcpy(c->orig, c->buf, bytes);
+}
+
+static void case_check(render_run_t *run, const gfx_case_t *c, const char *what, int n) {
+    const gfx_surface_t *s = &c->s;
+    run->checked++;
+    for (int p = 0; p < s->pages; ++p) {
+        for (int x = 0; x < s->width; ++x) {
+            const size_t i = (size_t)p * s->width + (size_t)x;
+            const char *err = c->buf[i] != c->want[i] ? "differs from the reference"
+                            : c->buf[i] != c->orig[i] && (x < c->dirty_x0[p] || x > c->dirty_x1[p]) ? "changed outside the dirty span"
+                            : NULL;
+            if (!err) continue;
+            fprintf(stderr, "gfx: %s case %d (%dx%d, clip %d,%d..%d,%d): byte at page %d, x %d %s\n",
+                    what, n, s->width, s->height, s->clip_x0, s->clip_y0, s->clip_x1, s->clip_y1, p, x, err);
+            run->mismatches++;
+            return;
+        }
+    }
+}
+
+static void check_fill(render_run_t *run, gfx_case_t *c, int n) {
+    const int x = rnd(-20, c->s.width + 4), y = rnd(-20, c->s.height + 4);
+    const int w = rnd(-2, c->s.width + 20), h = rnd(-2, c->s.height + 20), on = rnd(0, 1);
+    gfx_fill_rect(&c->s, x, y, w, h, on);
+    for (int j = 0; j < h; ++j)
+        for (int i = 0; i < w; ++i) ref_put(&c->s, c->want, x + i, y + j, on);
+    case_check(run, c, "fill_rect", n);
+}
+
+static void check_copy(render_run_t *run, gfx_case_t *c, int n, int pw, int ph) {
+    static uint8_t sbuf[GFX_BUF];
+    gfx_surface_t src;
+    gfx_surface_init(&src, sbuf, rnd(1, pw), rnd(1, ph));
+    for (size_t i = 0; i < (size_t)src.width * src.pages; ++i) sbuf[i] = (uint8_t)rnd(0, 255);
+    const int sx = rnd(-10, src.width), sy = rnd(-10, src.height);
+    const int dx = rnd(-20, c->s.width + 4), dy = rnd(-20, c->s.height + 4);
+    const int w = rnd(0, src.width + 10), h = rnd(0, src.height + 10);
+    const gfx_rop_t rop = (gfx_rop_t)rnd(GFX_ROP_COPY, GFX_ROP_XOR);
+    gfx_copy(&c->s, dx, dy, &src, sx, sy, w, h, rop);
+    for (int j = 0; j < h; ++j) {
+        for (int i = 0; i < w; ++i) {
+            if (sx + i < 0 || sy + j < 0 || sx + i >= src.width || sy + j >= src.height) continue;
+            const int x = dx + i, y = dy + j;
+            if (x < 0 || y < 0 || x >= c->s.width || y >= c->s.height) continue;
+            const int d = px_get(c->want, c->s.width, x, y), v = px_get(sbuf, src.width, sx + i, sy + j);
+            ref_put(&c->s, c->want, x, y, ref_rop(rop, d, v));
+        }
+    }
+    case_check(run, c, "copy", n);
+}
+
+static void check_blit(render_run_t *run, gfx_case_t *c, int n) {
+    static uint8_t data[GFX_BUF];
+    const int bw = rnd(1, 40), bh = rnd(1, 40);
+    for (size_t i = 0; i < (size_t)bw * (size_t)((bh + 7) / 8); ++i) data[i] = (uint8_t)rnd(0, 255);
+    const gfx_bitmap_t bm = { (uint16_t)bw, (uint16_t)bh, data };
+    const int x = rnd(-bw - 4, c->s.width + 4), y = rnd(-bh - 4, c->s.height + 4);
+    const gfx_rop_t rop = (gfx_rop_t)rnd(GFX_ROP_COPY, GFX_ROP_XOR);
+    gfx_blit(&c->s, x, y, &bm, rop);
+    for (int j = 0; j < bh; ++j) {
+        for (int i = 0; i < bw; ++i) {
+            if (x + i < 0 || y + j < 0 || x + i >= c->s.width || y + j >= c->s.height) continue;
+            const int d = px_get(c->want, c->s.width, x + i, y + j), v = px_get(data, bw, i, j);
+            ref_put(&c->s, c->want, x + i, y + j, ref_rop(rop, d, v));
+        }
+    }
+    case_check(run, c, "blit", n);
+}
+
+// Textbook Bresenham, one pixel per step, from the left end like gfx_draw_line.
+static void ref_line(const gfx_surface_t *s, uint8_t *want, int x0, int y0, int x1, int y1, int on) {
+    if (x0 > x1) { int t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+    const int dx = x1 - x0, dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    for (;;) {
+        ref_put(s, want, x0, y0, on);
+        if (x0 == x1 && y0 == y1) return;
+        const int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; ++x0; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+static void check_line(render_run_t *run, gfx_case_t *c, int n) {
+    const int x0 = rnd(-40, c->s.width + 40), y0 = rnd(-40, c->s.height + 40);
+    const int x1 = rnd(-40, c->s.width + 40), y1 = rnd(0, 3) ? rnd(-40, c->s.height + 40) : y0;
+    const int on = rnd(0, 1);
+    gfx_draw_line(&c->s, x0, y0, x1, y1, on);
+    ref_line(&c->s, c->want, x0, y0, x1, y1, on);
+    case_check(run, c, "line", n);
+}
+
+// Midpoint circle, the eight octants plotted pixel by pixel; a disc fills
+// each row between its leftmost and rightmost outline pixel.
+static void ref_circle(const gfx_surface_t *s, uint8_t *want, int cx, int cy, int r, int on, bool fill) {
+    int lo[2 * 80 + 1], hi[2 * 80 + 1];
+    for (int i = 0; i <= 2 * r; ++i) { lo[i] = r + 1; hi[i] = -r - 1; }
+    int x = 0, y = r, err = 1 - r;
+    while (x <= y) {
+        const int pt[8][2] = { { x, y }, { -x, y }, { x, -y }, { -x, -y }, { y, x }, { -y, x }, { y, -x }, { -y, -x } };
+        for (int k = 0; k < 8; ++k) {
+            const int px = pt[k][0], py = pt[k][1];
+            if (px < lo[py + r]) lo[py + r] = px;
+            if (px > hi[py + r]) hi[py + r] = px;
+            if (!fill) ref_put(s, want, cx + px, cy + py, on);
+        }
+        if (err < 0) err += 2 * x + 3;
+        else { err += 2 * (x - y) + 5; --y; }
+        ++x;
+    }
+    for (int i = 0; fill && i <= 2 * r; ++i)
+        for (int px = lo[i]; px <= hi[i]; ++px) ref_put(s, want, cx + px, cy + i - r, on);
+}
+
+static void check_circle(render_run_t *run, gfx_case_t *c, int n) {
+    const int r = rnd(0, 80), cx = rnd(-r - 4, c->s.width + r + 4), cy = rnd(-r - 4, c->s.height + r + 4);
+    const int on = rnd(0, 1);
+    const bool fill = rnd(0, 1);
+    if (fill) gfx_fill_circle(&c->s, cx, cy, r, on);
+    else      gfx_draw_circle(&c->s, cx, cy, r, on);
+    ref_circle(&c->s, c->want, cx, cy, r, on, fill);
+    case_check(run, c, fill ? "fill_circle" : "circle", n);
+}
+
+// Test card: an off-screen tile combined under each raster op at unaligned
+// offsets over a striped background, inside an unaligned clip.
+static void card_copy(ssd1306_t *dev) {
+    gfx_surface_t *s = &dev->surface;
+    const int W = SSD1306_WIDTH(dev), H = SSD1306_HEIGHT(dev);
+    static uint8_t tile_buf[28 * 3];
+    gfx_surface_t tile;
+    gfx_surface_init(&tile, tile_buf, 28, 20);
+    gfx_draw_rect(&tile, 0, 0, 28, 20, 1);
+    gfx_draw_text(&tile, 3, 3, "ROP");
+    gfx_fill_rect(&tile, 3, 12, 22, 5, 1);
+
+    ssd1306_clear(dev);
+    for (int y = 0; y < H; y += 4) gfx_fill_rect(s, 0, y, W, 2, 1);
+    gfx_set_clip(s, 3, 2, W - 7, H - 5);
+    for (int r = GFX_ROP_COPY; r <= GFX_ROP_XOR; ++r)
+        gfx_copy(s, 1 + 32 * r, 3 + 3 * r, &tile, 0, 0, 28, 20, (gfx_rop_t)r);
+    gfx_reset_clip(s);
+}
+
+// Test card: a fan of lines in every octant, circles and discs running off
+// the clip, inside an unaligned clip.
+static void card_shapes(ssd1306_t *dev) {
+    gfx_surface_t *s = &dev->surface;
+    const int W = SSD1306_WIDTH(dev), H = SSD1306_HEIGHT(dev);
+    ssd1306_clear(dev);
+    gfx_draw_rect(s, 0, 0, W, H, 1);
+    gfx_set_clip(s, 2, 3, W - 5, H - 6);
+    const int cx = W / 4, cy = H / 2;
+    for (int x = -8; x <= W / 2 + 8; x += 9) {
+        gfx_draw_line(s, cx, cy, x, -5, 1);
+        gfx_draw_line(s, cx, cy, x, H + 4, 1);
+    }
+    for (int y = 1; y < H; y += 7) gfx_draw_line(s, cx, cy, -5, y, 1);
+    gfx_fill_circle(s, W - 20, H / 2, H / 2 - 1, 1);
+    gfx_fill_circle(s, W - 20, H / 2, H / 4, 0);
+    gfx_draw_circle(s, W - 20, H / 2, H / 8, 1);
+    gfx_draw_circle(s, W / 2 + 8, H - 2, 13, 1);
+    gfx_reset_clip(s);
+}
+
+// Test card: a sprite under each raster op at unaligned offsets over a
+// half-lit background, partly off the panel's edges.
+static void card_blit(ssd1306_t *dev) {
+    static const uint8_t arrow[2 * 12] = {      // 12x11, page-major
+        0x20, 0x70, 0xF8, 0xFC, 0xFE, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+        0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+    const gfx_bitmap_t bm = { 12, 11, arrow };
+    gfx_surface_t *s = &dev->surface;
+    const int W = SSD1306_WIDTH(dev), H = SSD1306_HEIGHT(dev);
+    ssd1306_clear(dev);
+    gfx_fill_rect(s, 0, H / 2, W, H - H / 2, 1);
+    for (int r = GFX_ROP_COPY; r <= GFX_ROP_XOR; ++r) {
+        gfx_blit(s, 5 + 30 * r, H / 2 - 5 - r, &bm, (gfx_rop_t)r);
+        gfx_blit(s, 20 + 30 * r, H / 2 + 3 + r, &bm, (gfx_rop_t)r);
+    }
+    gfx_blit(s, -5, -3, &bm, GFX_ROP_OR);
+    gfx_blit(s, W - 7, H - 6, &bm, GFX_ROP_XOR);
+}
+
+static void run_gfx(render_run_t *run, ssd1306_t *dev, const port_t *port) {
+    const int pw = SSD1306_WIDTH(dev), ph = SSD1306_HEIGHT(dev);
+    static gfx_case_t c;
+    for (int n = 0; n < GFX_CASES; ++n) { case_init(&c, pw, ph); check_fill(run, &c, n); }
+    for (int n = 0; n < GFX_CASES; ++n) { case_init(&c, pw, ph); check_copy(run, &c, n, pw, ph); }
+    for (int n = 0; n < GFX_CASES; ++n) { case_init(&c, pw, ph); check_blit(run, &c, n); }
+    for (int n = 0; n < GFX_CASES; ++n) { case_init(&c, pw, ph); check_line(run, &c, n); }
+    for (int n = 0; n < GFX_CASES; ++n) { case_init(&c, pw, ph); check_circle(run, &c, n); }
+
+    void (*const card[])(ssd1306_t *) = { card_copy, card_shapes, card_blit };
+    for (int i = 0; i < (int)(sizeof(card) / sizeof(card[0])); ++i) {
+        card[i](dev);
+        ssd1306_submit(dev);
+        frame(run, dev, port, "gfx", i);
+    }
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--out DIR] [--check DIR] [--hello] [--gfx] [--size WxH] [script.txt ...]\n"
+            "  --out DIR    write every frame to DIR/<script>-NNN.pbm\n"
+            "  --check DIR  compare every frame with DIR/<script>-NNN.pbm; any difference fails\n"
+            "  --hello      render the hello screen as frame hello-000\n"
+            "  --gfx        render the gfx-NNN test cards and check the primitives per pixel\n"
+            "  --size WxH   panel geometry (default 128x64)\n",
+            argv0);
+}
+
+int main(int argc, char **argv) {
+    render_run_t run = {0};
+    bool hello = false, gfx = false;
+    unsigned w = 128, h = 64;
+    int nscripts = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) run.out_dir = argv[++i];
+        else if (strcmp(argv[i], "--check") == 0 && i + 1 < argc) run.check_dir = argv[++i];
+        else if (strcmp(argv[i], "--hello") == 0) hello = true;
+        else if (strcmp(argv[i], "--gfx") == 0) gfx = true;
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc && sscanf(argv[++i], "%ux%u", &w, &h) == 2) {}
+        else if (argv[i][0] != '-') argv[++nscripts] = argv[i];    // compact scripts to argv[1..]
+        else { usage(argv[0]); return 64; }
+    }
+    if (!run.out_dir && !run.check_dir) { usage(argv[0]); return 64; }
+
+    const port_display_cfg_t cfg = { .i2c_addr = 0x3C, .width = (uint16_t)w, .height = (uint16_t)h, .i2c_bus = 1 };
+    port_t *port = NULL;
+    if (port_open(&cfg, &port) != 0) return 2;
+    ssd1306_t dev = {0};
+    if (ssd1306_init(&dev, port) != 0) { port_close(port); return 3; }
+
+    int rc = 0;
+    if (hello) {
+        app_render_hello(&dev);
+        frame(&run, &dev, port, "hello", 0);
+    }
+    if (gfx) run_gfx(&run, &dev, port);
+    for (int i = 1; i <= nscripts; ++i)
+        if (run_script(&run, &dev, port, argv[i]) < 0) rc = 4;
+
+    printf("{\"frames\":%llu,\"written\":%llu,\"checked\":%llu,\"mismatches\":%llu}\n",
+           (unsigned long long)run.frames, (unsigned long long)run.written,
+           (unsigned long long)run.checked, (unsigned long long)run.mismatches);
+
+    ssd1306_deinit(&dev);
+    port_close(port);
+    if (rc) return rc;
+    return run.mismatches ? 1 : 0;
+}
@@ -0,0 +1,114 @@
+// tools/replay.c
+// Replays a frame capture (see ssd1306_capture.h) through the port layer, at
+// the recorded pace or as fast as the bus allows, and prints one JSON summary:
+//   {"file":"...","frames":N,"sessions":S,"loops":L,"elapsed_s":T,"fps":F,
+//    "bus_bytes":B,"bus_bytes_per_s":R}
+//
+//   oled_replay [--max | --speed X] [--loop N] [--bus N] [--addr A] capture.bin
+//
+// With PORT=sim and OLED_SIM_BUS_HZ set this is a reproducible bus workload.
+
+#define _POSIX_C_SOURCE 200809L   // clock_nanosleep, mmap
+#include "port.h"
+#include "ssd1306.h"
+#include "ssd1306_capture.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void sleep_until_ns(uint64_t t) {
+    const struct timespec ts = { .tv_sec = (time_t)(t / 1000000000ull), .tv_nsec = (long)(t % 1000000000ull) };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0) {}
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--max | --speed X] [--loop N] [--bus N] [--addr A] capture.bin\n"
+            "  --max       send frames back to back (default: recorded timing)\n"
+            "  --speed X   play at X times the recorded pace\n"
+            "  --loop N    play the file N times (default 1)\n"
+            "  --bus N     I2C bus of the panel (default 1)\n"
+            "  --addr A    I2C address of the panel (default 0x3C)\n",
+            argv0);
+}
+
+int main(int argc, char **argv) {
+    double   speed = 1.0;               // 0: as fast as possible
+    long     loops = 1;
+    unsigned bus = 1, addr = 0x3C;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--max") == 0) speed = 0;
+        else if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc) speed = strtod(argv[++i], NULL);
+        else if (strcmp(argv[i], "--loop") == 0 && i + 1 < argc) loops = strtol(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--bus") == 0 && i + 1 < argc) bus = (unsigned)strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--addr") == 0 && i + 1 < argc) addr = (unsigned)strtoul(argv[++i], NULL, 0);
+        else if (argv[i][0] != '-' && !path) path = argv[i];
+        else { usage(argv[0]); return 64; }
+    }
+    if (!path || speed < 0 || loops < 1) { usage(argv[0]); return 64; }
+
+    // Map the whole capture; frames are decoded straight from the mapping
+    const int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || st.st_size <= 0) { perror(path); return 1; }
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) { perror("mmap"); return 1; }
+    posix_madvise(map, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+
+    ssd1306_capture_reader_t rd;
+    if (ssd1306_capture_reader_init(&rd, map, (size_t)st.st_size) < 0) {
+        fprintf(stderr, "%s: not a frame capture\n", path);
+        return 1;
+    }
+
+    const port_display_cfg_t cfg = { .i2c_addr = (uint8_t)addr, .width = rd.width, .height = rd.height,
+                                     .i2c_bus = (uint8_t)bus };
+    port_t *port = NULL;
+    if (port_open(&cfg, &port) != 0) return 2;
+    ssd1306_t dev = {0};
+    if (ssd1306_init(&dev, port) != 0) { port_close(port); return 3; }
+
+    uint64_t frames = 0, sessions = 0, bus_bytes = 0, t_base_us = 0;
+    int rc = 0;
+    const uint64_t t0 = now_ns();
+    for (long l = 0; l < loops && rc >= 0; ++l) {
+        ssd1306_capture_reader_init(&rd, map, (size_t)st.st_size);
+        while ((rc = ssd1306_capture_read(&rd, &dev)) > 0) {
+            if (speed > 0) sleep_until_ns(t0 + (uint64_t)((double)(t_base_us + rd.t_us) * 1000.0 / speed));
+            if (ssd1306_update_dirty(&dev) < 0) { rc = -10; break; }
+            bus_bytes += dev.last_flush_bytes;
+        }
+        frames += rd.frames;
+        sessions += rd.sessions;
+        t_base_us += rd.t_us;
+    }
+    const double secs = (double)(now_ns() - t0) / 1e9;
+
+    if (rc < 0) fprintf(stderr, "%s: %s after frame %llu\n", path,
+                        rc == -10 ? "bus write failed" : "corrupt record", (unsigned long long)frames);
+    printf("{\"file\":\"%s\",\"frames\":%llu,\"sessions\":%llu,\"loops\":%ld,\"elapsed_s\":%.3f,"
+           "\"fps\":%.1f,\"bus_bytes\":%llu,\"bus_bytes_per_s\":%.0f}\n",
+           path, (unsigned long long)frames, (unsigned long long)sessions, loops, secs,
+           secs > 0 ? (double)frames / secs : 0.0, (unsigned long long)bus_bytes,
+           secs > 0 ? (double)bus_bytes / secs : 0.0);
+
+    ssd1306_deinit(&dev);
+    port_close(port);
+    munmap(map, (size_t)st.st_size);
+    return rc < 0 ? 4 : 0;
+}
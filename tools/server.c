@@ -0,0 +1,87 @@
+// tools/server.c
+// Display server daemon: owns the panel and composites local clients onto it
+// (see oled_server.h). Runs until SIGINT or SIGTERM.
+//
+//   oled_server [--socket PATH] [--bus N] [--addr A] [--size WxH] [--warm] [--state FILE]
+//
+// Clients: the calculator with `oled_demo --display [--region x,y,w,h]`, or
+// any program using oled_client.h.
+
+#define _POSIX_C_SOURCE 200809L   // sigaction
+#include "port.h"
+#include "ssd1306.h"
+#include "ssd1306_async.h"
+#include "ssd1306_state.h"
+#include "oled_server.h"
+
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static volatile sig_atomic_t g_stop;
+
+static void on_signal(int sig) {
+    (void)sig;
+    g_stop = 1;
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--socket PATH] [--bus N] [--addr A] [--size WxH] [--warm] [--state FILE]\n"
+            "  --socket PATH  listen on PATH (default $OLED_SERVER_SOCKET or " OLED_SERVER_SOCKET ")\n"
+            "  --bus N        I2C bus of the panel (default 1)\n"
+            "  --addr A       I2C address of the panel (default 0x3C)\n"
+            "  --size WxH     panel size (default 128x64)\n"
+            "  --warm         attach to a panel an earlier run left configured\n"
+            "  --state FILE   with --warm, the saved panel contents; saved again on exit\n",
+            argv0);
+}
+
+int main(int argc, char **argv) {
+    const char *sock = NULL, *state_path = NULL;
+    unsigned bus = 1, addr = 0x3C, w = 128, h = 64;
+    bool     warm = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) sock = argv[++i];
+        else if (strcmp(argv[i], "--bus") == 0 && i + 1 < argc) bus = (unsigned)strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--addr") == 0 && i + 1 < argc) addr = (unsigned)strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc && sscanf(argv[++i], "%ux%u", &w, &h) == 2) {}
+        else if (strcmp(argv[i], "--state") == 0 && i + 1 < argc) state_path = argv[++i];
+        else if (strcmp(argv[i], "--warm") == 0) warm = true;
+        else { usage(argv[0]); return 64; }
+    }
+    if (w < 1 || w > 128 || h < 8 || h > 8 * SSD1306_MAX_PAGES || h % 8) { usage(argv[0]); return 64; }
+
+    const port_display_cfg_t cfg = { .i2c_addr = (uint8_t)addr, .width = (uint16_t)w, .height = (uint16_t)h,
+                                     .i2c_bus = (uint8_t)bus };
+    port_t *port = NULL;
+    if (port_open(&cfg, &port) != 0) return 1;
+
+    static uint8_t last_frame[128 * SSD1306_MAX_PAGES];
+    const bool have_frame = warm && state_path && ssd1306_state_load(state_path, cfg.width, cfg.height, last_frame) == 0;
+    ssd1306_t dev = {0};
+    const int irc = (warm && (have_frame || !state_path)) ? ssd1306_init_warm(&dev, port, have_frame ? last_frame : NULL)
+                                                          : ssd1306_init(&dev, port);
+    if (irc != 0) { port_close(port); return 2; }
+
+    // No SA_RESTART: the signal has to wake the server out of poll()
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    ssd1306_async_start(&dev);
+    const int rc = oled_server_run(&dev, sock, &g_stop);
+    if (rc < 0) fprintf(stderr, "cannot listen on %s\n", oled_server_socket_path(sock));
+    ssd1306_async_stop(&dev);
+
+    if (state_path && ssd1306_state_save(&dev, state_path) != 0) fprintf(stderr, "cannot save panel state to %s\n", state_path);
+    ssd1306_deinit(&dev);
+    port_close(port);
+    return rc < 0 ? 3 : 0;
+}